@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#
+# Generator of synthetic C translation units stressing the vast pipeline.
+# Every workload is parameterised by a single size `n`, so that compiling
+# the same workload with growing `n` gives a scaling curve:
+#
+#   ./bench/generate.py functions 1000 -o functions.c
+#   ./bench/generate.py header 500 -o header.c   # also writes header.h
+#
+
+import argparse
+import os
+import sys
+
+
+def functions(n: int) -> str:
+    # many small functions calling each other
+    out = ["int f0(int x) { return x + 1; }"]
+    for i in range(1, n):
+        out.append(
+            f"int f{i}(int x) {{\n"
+            f"    int y = x * {i};\n"
+            f"    if (y > {i}) y -= f{i - 1}(x);\n"
+            f"    return y;\n"
+            f"}}"
+        )
+    out.append(f"int main(void) {{ return f{n - 1}(1); }}")
+    return "\n\n".join(out) + "\n"
+
+
+def nesting(n: int) -> str:
+    # deeply nested scopes and control flow, depth grows with `n`
+    depth = max(1, n // 10)
+    body = []
+    for i in range(depth):
+        indent = "    " * (i + 1)
+        kind = i % 3
+        if kind == 0:
+            body.append(f"{indent}if (x > {i}) {{ int v{i} = x - {i};")
+        elif kind == 1:
+            body.append(f"{indent}for (int i{i} = 0; i{i} < x; ++i{i}) {{ x -= i{i};")
+        else:
+            body.append(f"{indent}while (x > {i}) {{ x /= 2;")
+    body.append("    " * (depth + 1) + "x += 1;")
+    for i in reversed(range(depth)):
+        body.append("    " * (i + 1) + "}")
+
+    return (
+        "int nested(int x) {\n"
+        + "\n".join(body)
+        + "\n    return x;\n}\n\n"
+        "int main(void) { return nested(42); }\n"
+    )
+
+
+def structs(n: int) -> str:
+    # huge records and accesses to their members
+    out = ["struct big {"]
+    out += [f"    int m{i};" for i in range(n)]
+    out.append("};\n")
+    out.append("union wide {")
+    out += [f"    {'long' if i % 2 else 'char'} u{i};" for i in range(n)]
+    out.append("};\n")
+    out.append("int sum(struct big *b, union wide *w) {")
+    out.append("    int s = 0;")
+    out += [f"    s += b->m{i};" for i in range(n)]
+    out += [f"    s += (int) w->u{i};" for i in range(0, n, 8)]
+    out.append("    return s;")
+    out.append("}\n")
+    out.append("int main(void) { struct big b = {0}; union wide w = {0}; return sum(&b, &w); }")
+    return "\n".join(out) + "\n"
+
+
+def initializers(n: int) -> str:
+    # large initializer lists of scalars and records
+    values = ", ".join(str(i % 97) for i in range(n))
+    pairs = ", ".join(f"{{ {i}, {n - i} }}" for i in range(n))
+    return (
+        f"int table[{n}] = {{ {values} }};\n\n"
+        "struct pair { int a, b; };\n"
+        f"struct pair pairs[{n}] = {{ {pairs} }};\n\n"
+        "int main(void) {\n"
+        f"    int local[{n}] = {{ {values} }};\n"
+        f"    return table[{n - 1}] + pairs[0].b + local[0];\n"
+        "}\n"
+    )
+
+
+def typedefs(n: int) -> str:
+    # long chains of typedefs used throughout the unit
+    out = ["typedef int t0;", "typedef struct s0 { int v; } r0;"]
+    for i in range(1, n):
+        out.append(f"typedef t{i - 1} t{i};")
+        out.append(f"typedef r{i - 1} r{i};")
+    out.append("")
+    out.append(f"t{n - 1} use(r{n - 1} r) {{")
+    out += [f"    t{i} v{i} = r.v + {i};" for i in range(0, n, max(1, n // 64))]
+    out.append(f"    return (t{n - 1}) r.v;")
+    out.append("}\n")
+    out.append(f"int main(void) {{ r{n - 1} r = {{ 1 }}; return use(r); }}")
+    return "\n".join(out) + "\n"
+
+
+def switches(n: int) -> str:
+    # switch statements with many cases and fallthroughs
+    out = ["int dispatch(int x) {", "    int r = 0;", "    switch (x) {"]
+    for i in range(n):
+        out.append(f"        case {i}: r += {i};")
+        if i % 4 == 3:
+            out.append("            break;")
+    out += ["        default: r = -1;", "    }", "    return r;", "}\n"]
+    out.append("int main(void) { return dispatch(7); }")
+    return "\n".join(out) + "\n"
+
+
+def header(n: int) -> tuple:
+    # big header with mostly unused declarations, returns (source, header)
+    h = ["#pragma once", ""]
+    h += [f"int decl{i}(int, const char *);" for i in range(n)]
+    h += [f"typedef struct rec{i} {{ int a; long b; struct rec{i} *next; }} rec{i}_t;" for i in range(n // 4)]
+    h += [f"enum e{i} {{ E{i}_A, E{i}_B = {i}, E{i}_C }};" for i in range(n // 4)]
+    h += [f"static inline int inl{i}(int x) {{ return x * {i} + E{i}_B; }}" for i in range(n // 4)]
+    h += [f"#define MACRO{i}(x) ((x) + {i})" for i in range(n // 4)]
+
+    src = (
+        '#include "header.h"\n\n'
+        "int main(void) {\n"
+        "    rec0_t r = { 1, 2, 0 };\n"
+        f"    return inl0(r.a) + MACRO0(E0_C);\n"
+        "}\n"
+    )
+    return src, "\n".join(h) + "\n"
+
+
+workloads = {
+    "functions"    : functions,
+    "nesting"      : nesting,
+    "structs"      : structs,
+    "initializers" : initializers,
+    "typedefs"     : typedefs,
+    "switch"       : switches,
+    "header"       : header,
+}
+
+
+def write(workload: str, n: int, path: str):
+    # writes workload of size `n` to `path`, auxiliary headers next to it
+    result = workloads[workload](n)
+    if isinstance(result, tuple):
+        result, hdr = result
+        with open(os.path.join(os.path.dirname(path), "header.h"), "w") as out:
+            out.write(hdr)
+
+    with open(path, "w") as out:
+        out.write(result)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="synthetic C workload generator")
+    parser.add_argument("workload", choices=sorted(workloads), help="kind of workload")
+    parser.add_argument("size", type=int, help="size of the workload")
+    parser.add_argument("-o", "--output", required=True, help="path of the generated source")
+    opts = parser.parse_args()
+
+    if opts.size < 1:
+        parser.error("size must be positive")
+
+    write(opts.workload, opts.size, os.path.abspath(opts.output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
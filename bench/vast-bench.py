@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#
+# Scaling benchmark of the vast pipeline. Compiles synthetic workloads of
+# growing size (see generate.py) and reports time of codegen and of every
+# stage of the default conversion path (hl -> std -> abi -> llvm), together
+# with the empirical scaling exponent of each of them and of each pass:
+#
+#   ./bench/vast-bench.py builds/default/tools/vast-front/vast-front
+#   ./bench/vast-bench.py vast-front --workloads structs,switch --sizes 100,1000,10000
+#
+# Timings come from -vast-stats. A stage is timed as the difference of
+# pipeline times of compilations stopping after it and after the previous
+# stage. The exponent `k` is the least-squares slope of log(time) against
+# log(size), i.e., time ~ size^k; anything notably above 1 hints at
+# quadratic behaviour.
+#
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import generate
+
+# compilation targets in order of the default conversion path, `hl` is
+# reduced high level MLIR (requires -vast-simplify)
+stages = [
+    ("hl",  ["-vast-emit-mlir=hl", "-vast-simplify"]),
+    ("std", ["-vast-emit-mlir=std"]),
+    ("abi", ["-vast-emit-mlir=abi"]),
+    ("llvm", ["-vast-emit-mlir=llvm"]),
+]
+
+# times below this threshold (seconds) are too noisy to estimate scaling
+noise_floor = 0.005
+
+
+def run_vast(binary: str, src: str, args: list, extra: list) -> dict:
+    stats = src + ".stats.json"
+    cmd = [binary] + args + extra + [f"-vast-stats={stats}", src, "-o", os.devnull]
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+    with open(stats) as f:
+        return json.load(f)
+
+
+def phase(stats: dict, name: str) -> float:
+    return sum(p["wall"] for p in stats["phases"] if p["name"] == name)
+
+
+def measure(binary: str, src: str, runs: int, extra: list) -> dict:
+    # best of `runs` for codegen, each stage and each pass
+    best = {}
+
+    def update(key: str, value: float):
+        best[key] = min(best.get(key, math.inf), value)
+
+    for _ in range(runs):
+        previous = 0.0
+        for stage, args in stages:
+            stats = run_vast(binary, src, args, extra)
+            pipeline = phase(stats, "pipeline")
+            update(f"stage:{stage}", max(0.0, pipeline - previous))
+            previous = pipeline
+
+        # the last compilation ran the whole path
+        update("codegen", phase(stats, "codegen"))
+        update("total", sum(p["wall"] for p in stats["phases"]))
+        per_pass = {}
+        for p in stats["passes"]:
+            per_pass[p["name"]] = per_pass.get(p["name"], 0.0) + p["wall"]
+        for name, wall in per_pass.items():
+            update(f"pass:{name}", wall)
+
+    return best
+
+
+def exponent(sizes: list, times: list) -> float:
+    points = [(math.log(s), math.log(t)) for s, t in zip(sizes, times) if t > 0]
+    if len(points) < 2:
+        return math.nan
+
+    mx = sum(x for x, _ in points) / len(points)
+    my = sum(y for _, y in points) / len(points)
+    var = sum((x - mx) ** 2 for x, _ in points)
+    cov = sum((x - mx) * (y - my) for x, y in points)
+    return cov / var if var else math.nan
+
+
+def run_workload(binary: str, workload: str, sizes: list, runs: int, extra: list) -> dict:
+    results = {}
+    with tempfile.TemporaryDirectory() as tmp:
+        for size in sizes:
+            src = os.path.join(tmp, f"{workload}-{size}.c")
+            generate.write(workload, size, src)
+            results[size] = measure(binary, src, runs, extra)
+            print(f"  {workload} n={size}: {results[size]['total'] * 1000:.1f} ms", file=sys.stderr)
+    return results
+
+
+def report(workload: str, sizes: list, results: dict, threshold: float) -> list:
+    keys = ["codegen"] + [f"stage:{stage}" for stage, _ in stages]
+    keys += sorted(k for k in results[sizes[-1]] if k.startswith("pass:"))
+
+    print(f"\n{workload}")
+    print(f"  {'':40}" + "".join(f"{'n=' + str(s):>12}" for s in sizes) + f"{'k':>8}")
+
+    superlinear = []
+    for key in keys:
+        times = [results[s].get(key, 0.0) for s in sizes]
+        k = exponent(sizes, times)
+        flag = ""
+        if times[-1] >= noise_floor and k > threshold:
+            flag = "  <-- superlinear"
+            superlinear.append((workload, key, k))
+
+        row = "".join(f"{t * 1000:10.2f}ms" for t in times)
+        print(f"  {key:40}{row}{k:8.2f}{flag}")
+
+    return superlinear
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="vast pipeline scaling benchmark")
+    parser.add_argument("binary", help="vast-front binary")
+    parser.add_argument("--workloads", default=",".join(sorted(generate.workloads)),
+                        help="comma separated list of workloads")
+    parser.add_argument("--sizes", default="250,500,1000,2000",
+                        help="comma separated list of workload sizes")
+    parser.add_argument("--runs", type=int, default=3, help="runs per size, best is taken")
+    parser.add_argument("--threshold", type=float, default=1.5,
+                        help="scaling exponent reported as superlinear")
+    parser.add_argument("--json", help="write raw measurements to this file")
+    parser.add_argument("--fail-on-superlinear", action="store_true",
+                        help="exit with failure if any superlinear scaling is found")
+    parser.add_argument("--extra", action="append", default=[],
+                        help="extra argument passed to vast-front")
+    opts = parser.parse_args()
+
+    workloads = opts.workloads.split(",")
+    for workload in workloads:
+        if workload not in generate.workloads:
+            parser.error(f"unknown workload: {workload}")
+
+    sizes = sorted(int(s) for s in opts.sizes.split(","))
+    if len(sizes) < 2 or sizes[0] < 1:
+        parser.error("expected at least two positive sizes")
+
+    # deeply nested workloads exceed default bracket depth
+    extra = ["-fbracket-depth=4096"] + opts.extra
+
+    raw, superlinear = {}, []
+    for workload in workloads:
+        raw[workload] = run_workload(opts.binary, workload, sizes, opts.runs, extra)
+        superlinear += report(workload, sizes, raw[workload], opts.threshold)
+
+    if opts.json:
+        with open(opts.json, "w") as out:
+            json.dump(raw, out, indent=2)
+
+    if superlinear:
+        print("\nsuperlinear scaling:")
+        for workload, key, k in superlinear:
+            print(f"  {workload}: {key} (k = {k:.2f})")
+
+    return 1 if superlinear and opts.fail_on_superlinear else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
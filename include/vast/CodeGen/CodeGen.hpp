@@ -7,7 +7,6 @@
 VAST_RELAX_WARNINGS
 #include <clang/Frontend/ASTUnit.h>
 #include <mlir/IR/Verifier.h>
-#include <mlir/InitAllDialects.h>
 VAST_UNRELAX_WARNINGS
 
 #include "vast/CodeGen/DefaultVisitor.hpp"
@@ -66,9 +65,19 @@ namespace vast::cg
         codegen_instance(codegen_context &cgctx, meta_generator &meta)
             : base(cgctx, meta)
         {
-            mlir::registerAllDialects(cgctx.mctx);
             vast::registerAllDialects(cgctx.mctx);
-            cgctx.mctx.loadAllAvailableDialects();
+            vast::registerDependentDialects(cgctx.mctx);
+
+            // Load just the dialects that codegen emits, the rest is loaded
+            // on demand by the pipeline.
+            cgctx.mctx.loadDialect<
+                hl::HighLevelDialect,
+                hlbi::HLBuiltinDialect,
+                core::CoreDialect,
+                meta::MetaDialect,
+                unsup::UnsupportedDialect,
+                mlir::DLTIDialect
+            >();
 
             scope = std::unique_ptr< scope_t >( new scope_t{
                 .typedefs   = cgctx.typedefs,
@@ -215,7 +224,33 @@ namespace vast::cg
             };
 
             if (norecurse()) {
-                ; // TODO: support norecurse attr
+                fn->setAttr(hl::NoRecurseAttr::getMnemonic(), hl::NoRecurseAttr::get(&mcontext()));
+            }
+
+            // Propagate the inline hint of any redeclaration or of the template
+            // pattern. Explicit `noinline` and `always_inline` take precedence.
+            auto inline_specified = [] (const clang::FunctionDecl *decl) {
+                auto specified = [] (const clang::FunctionDecl *redecl) {
+                    return redecl->isInlineSpecified();
+                };
+
+                if (llvm::any_of(decl->redecls(), specified)) {
+                    return true;
+                }
+
+                if (const auto *pattern = decl->getTemplateInstantiationPattern()) {
+                    return llvm::any_of(pattern->redecls(), specified);
+                }
+
+                return false;
+            };
+
+            if (function_decl
+                && !function_decl->hasAttr< clang::NoInlineAttr >()
+                && !function_decl->hasAttr< clang::AlwaysInlineAttr >()
+                && inline_specified(function_decl)
+            ) {
+                fn->setAttr(hl::InlineHintAttr::getMnemonic(), hl::InlineHintAttr::get(&mcontext()));
             }
 
             // TODO: fp rounding and exception behavior
@@ -59,6 +59,18 @@ namespace vast::cg {
             return make< hl::AlwaysInlineAttr >();
         }
 
+        mlir_attr VisitNoInlineAttr(const clang::NoInlineAttr *attr) {
+            return make< hl::NoInlineAttr >();
+        }
+
+        mlir_attr VisitColdAttr(const clang::ColdAttr *attr) {
+            return make< hl::ColdAttr >();
+        }
+
+        mlir_attr VisitHotAttr(const clang::HotAttr *attr) {
+            return make< hl::HotAttr >();
+        }
+
         mlir_attr VisitLoaderUninitializedAttr(const clang::LoaderUninitializedAttr *attr) {
             return make< hl::LoaderUninitializedAttr >();
         }
@@ -91,6 +103,10 @@ namespace vast::cg {
             return make< hl::NonNullAttr >();
         }
 
+        mlir_attr VisitReturnsNonNullAttr(const clang::ReturnsNonNullAttr *attr) {
+            return make< hl::ReturnsNonNullAttr >();
+        }
+
         mlir_attr VisitModeAttr(const clang::ModeAttr *attr) {
             return make< hl::ModeAttr >(attr->getMode()->getName());
         }
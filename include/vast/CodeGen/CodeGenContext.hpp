@@ -7,10 +7,14 @@
 VAST_RELAX_WARNINGS
 #include <clang/AST/GlobalDecl.h>
 #include <clang/AST/ASTContext.h>
+#include <clang/Basic/CodeGenOptions.h>
 #include <clang/Basic/SourceManager.h>
 #include <llvm/ADT/ScopedHashTable.h>
 #include <llvm/ADT/SmallPtrSet.h>
+#include <llvm/ADT/StringMap.h>
 #include <llvm/IR/GlobalValue.h>
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/IR/DialectResourceBlobManager.h>
 #include <mlir/IR/MLIRContext.h>
 #include <mlir/IR/Value.h>
 #include <mlir/Support/LogicalResult.h>
@@ -24,6 +28,7 @@ VAST_UNRELAX_WARNINGS
 #include "vast/Dialect/HighLevel/HighLevelOps.hpp"
 #include "vast/Dialect/HighLevel/HighLevelAttributes.hpp"
 #include "vast/Dialect/HighLevel/HighLevelTypes.hpp"
+#include "vast/Dialect/HighLevel/TypeDefinitionIndex.hpp"
 #include "vast/Dialect/Core/CoreOps.hpp"
 #include "vast/Dialect/Core/CoreAttributes.hpp"
 #include "vast/Util/Functions.hpp"
@@ -74,6 +79,42 @@ namespace vast::cg
         }
     } // namespace detail
 
+    //
+    // Cache of clang types converted to high-level types. Entries are keyed by
+    // the opaque pointer of `clang::QualType`, i.e., by the (possibly sugared)
+    // type node together with its fast qualifiers.
+    //
+    struct type_cache
+    {
+        mlir_type lookup(clang::QualType ty) {
+            if (auto it = types.find(ty.getAsOpaquePtr()); it != types.end()) {
+                ++hits;
+                return it->second;
+            }
+
+            ++misses;
+            return {};
+        }
+
+        void insert(clang::QualType ty, mlir_type type) {
+            types.try_emplace(ty.getAsOpaquePtr(), type);
+        }
+
+        // Conversions that have side effects beyond the resulting type (e.g.,
+        // emit an operation or depend on completeness of a declaration) mark
+        // themselves, so that no enclosing type is cached.
+        void mark_uncacheable() { ++uncacheable_conversions; }
+
+        std::size_t generation() const { return uncacheable_conversions; }
+
+        std::size_t hits   = 0;
+        std::size_t misses = 0;
+
+      private:
+        std::size_t uncacheable_conversions = 0;
+        llvm::DenseMap< void *, mlir_type > types;
+    };
+
     struct codegen_context {
         mcontext_t &mctx;
         acontext_t &actx;
@@ -135,6 +176,21 @@ namespace vast::cg
 
         llvm::DenseMap< mangled_name_ref, mlir_value > global_decls;
 
+        // Module-level symbols and type definitions indexed as they are
+        // declared, so that lookups do not need to scan the module.
+        llvm::StringMap< operation > global_symbols;
+        hl::type_definition_index type_definitions;
+
+        type_cache types;
+
+        // Overrides the language rules of which loops must make progress
+        // (`-ffinite-loops` and `-fno-finite-loops`).
+        using finite_loops_kind = clang::CodeGenOptions::FiniteLoopsKind;
+        finite_loops_kind finite_loops = finite_loops_kind::Language;
+
+        // Blobs of large string literals, shared by all their occurrences.
+        llvm::StringMap< mlir::DenseResourceElementsAttr > string_literals;
+
         // A set of references that have only been seen via a weakref so far. This is
         // used to remove the weak of the reference if we ever see a direct reference
         // or a definition.
@@ -179,9 +235,7 @@ namespace vast::cg
         }
 
         operation get_global_value(mangled_name_ref name) {
-            if (auto global = mlir::SymbolTable::lookupSymbolIn(mod.get(), name.name))
-                return global;
-            return {};
+            return global_symbols.lookup(name.name);
         }
 
         mlir_value get_global_value(const clang::Decl * /* decl */) {
@@ -259,7 +313,13 @@ namespace vast::cg
         }
 
         hl::FuncOp declare(mangled_name_ref mangled, auto vast_decl_builder) {
-            return declare< hl::FuncOp >(funcdecls, mangled, vast_decl_builder, mangled.name);
+            return declare< hl::FuncOp >(funcdecls, mangled, [&] {
+                auto fn = vast_decl_builder();
+                if (fn) {
+                    global_symbols.try_emplace(mangled.name, fn);
+                }
+                return fn;
+            }, mangled.name);
         }
 
         mlir_value declare(const clang::VarDecl *decl, mlir_value vast_value) {
@@ -267,7 +327,13 @@ namespace vast::cg
         }
 
         mlir_value declare(const clang::VarDecl *decl, auto vast_decl_builder) {
-            return declare< mlir_value >(vars, decl, vast_decl_builder, decl->getName());
+            return declare< mlir_value >(vars, decl, [&] {
+                mlir_value var = vast_decl_builder();
+                if (var && decl->isFileVarDecl()) {
+                    global_symbols.try_emplace(get_mangled_name(decl).name, var.getDefiningOp());
+                }
+                return var;
+            }, decl->getName());
         }
 
         hl::LabelDeclOp declare(const clang::LabelDecl *decl, auto vast_decl_builder) {
@@ -275,7 +341,13 @@ namespace vast::cg
         }
 
         hl::TypeDefOp declare(const clang::TypedefDecl *decl, auto vast_decl_builder) {
-            return declare< hl::TypeDefOp >(typedefs, decl, vast_decl_builder, decl->getName());
+            return declare< hl::TypeDefOp >(typedefs, decl, [&] {
+                auto def = vast_decl_builder();
+                if (def) {
+                    type_definitions.insert(def);
+                }
+                return def;
+            }, decl->getName());
         }
 
         hl::TypeDeclOp declare(const clang::TypeDecl *decl, auto vast_decl_builder) {
@@ -91,6 +91,80 @@ namespace vast::cg {
             }
         }
 
+        // Records facts about pointer parameters that are lost once the
+        // parameter types are lowered: `restrict`, pointee `const`, `nonnull`
+        // (from the parameter or the function attribute) and the number of
+        // dereferenceable bytes of references and `static` array parameters.
+        void visit_param_attrs(const clang::FunctionDecl *decl, vast_function fn) {
+            auto &actx = acontext();
+
+            // Instance methods take `this` as the first argument.
+            unsigned offset = 0;
+            if (auto method = clang::dyn_cast< clang::CXXMethodDecl >(decl)) {
+                offset = method->isInstance() ? 1 : 0;
+            }
+
+            auto set = [&] (unsigned idx, auto attr) {
+                fn.setArgAttr(idx + offset, std::remove_cvref_t< decltype(attr) >::getMnemonic(), attr);
+            };
+
+            auto is_nonnull = [&] (unsigned idx, const clang::ParmVarDecl *param) {
+                if (param->hasAttr< clang::NonNullAttr >())
+                    return true;
+                for (const auto *attr : decl->specific_attrs< clang::NonNullAttr >()) {
+                    if (attr->isNonNull(idx))
+                        return true;
+                }
+                return false;
+            };
+
+            for (unsigned idx = 0; idx < decl->getNumParams(); ++idx) {
+                // Unprototyped functions may have fewer arguments than parameters.
+                if (idx + offset >= fn.getNumArguments())
+                    break;
+
+                const auto *param = decl->getParamDecl(idx);
+                auto type = param->getType();
+
+                if (type->isPointerType()) {
+                    // A const pointee is a fact only for restrict pointers,
+                    // otherwise the const may be legally cast away.
+                    if (type.isRestrictQualified()) {
+                        set(idx, mlir_builder().template getAttr< hl::RestrictAttr >());
+                        if (type->getPointeeType().isConstQualified())
+                            set(idx, mlir_builder().template getAttr< hl::ConstAttr >());
+                    }
+                    if (is_nonnull(idx, param))
+                        set(idx, mlir_builder().template getAttr< hl::NonNullAttr >());
+                }
+
+                if (const auto *ref = type->getAs< clang::ReferenceType >()) {
+                    set(idx, mlir_builder().template getAttr< hl::NonNullAttr >());
+
+                    auto pointee = ref->getPointeeType();
+                    if (!pointee->isIncompleteType() && pointee->isConstantSizeType()) {
+                        auto bytes = std::uint64_t(actx.getTypeSizeInChars(pointee).getQuantity());
+                        if (bytes) {
+                            set(idx, mlir_builder().template getAttr< hl::DereferenceableAttr >(bytes));
+                        }
+                    }
+                }
+
+                // `T p[static N]` guarantees at least `N` valid elements.
+                if (const auto *arr = actx.getAsConstantArrayType(param->getOriginalType())) {
+                    auto elem = arr->getElementType();
+                    auto size = arr->getSize().getZExtValue();
+                    if (arr->getSizeModifier() == clang::ArrayType::Static && size) {
+                        set(idx, mlir_builder().template getAttr< hl::NonNullAttr >());
+                        if (!elem->isIncompleteType() && elem->isConstantSizeType()) {
+                            auto bytes = std::uint64_t(actx.getTypeSizeInChars(elem).getQuantity()) * size;
+                            set(idx, mlir_builder().template getAttr< hl::DereferenceableAttr >(bytes));
+                        }
+                    }
+                }
+            }
+        }
+
         static bool is_defaulted_method(const clang::FunctionDecl *function_decl)  {
             if (function_decl->isDefaulted() && clang::isa< clang::CXXMethodDecl >(function_decl)) {
                 auto method = clang::cast< clang::CXXMethodDecl >(function_decl);
@@ -117,6 +191,15 @@ namespace vast::cg {
             });
 
             visit_decl_attrs(function_decl, fn);
+            visit_param_attrs(function_decl, fn);
+
+            // Functions with a non-throwing exception specification never
+            // unwind, same as those with explicit `nothrow`.
+            if (const auto *proto = function_decl->getType()->template getAs< clang::FunctionProtoType >()) {
+                if (proto->isNothrow()) {
+                    fn->setAttr(hl::NoThrowAttr::getMnemonic(), mlir_builder().template getAttr< hl::NoThrowAttr >());
+                }
+            }
 
             VAST_CHECK(fn.isDeclaration(), "expected empty body");
 
@@ -16,6 +16,7 @@ VAST_UNRELAX_WARNINGS
 
 #include "vast/Util/Common.hpp"
 #include "vast/Util/DataLayout.hpp"
+#include "vast/Util/Trace.hpp"
 
 namespace vast::cg
 {
@@ -72,6 +73,9 @@ namespace vast::cg
         const acontext_t &acontext() const { return cgctx.actx; }
         const mcontext_t &mcontext() const { return cgctx.mctx; }
 
+        // Records spans of top level decls and deferred emission (-vast-trace).
+        void set_tracer(trace::recorder *rec) { tracer = rec; }
+
     private:
 
         operation build_global_function_declaration(clang::GlobalDecl decl);
@@ -131,6 +135,8 @@ namespace vast::cg
 
         meta_generator_ptr meta;
         default_codegen codegen;
+
+        trace::recorder *tracer = nullptr;
     };
 
 } // namespace vast::cg
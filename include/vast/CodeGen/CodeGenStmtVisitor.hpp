@@ -7,6 +7,9 @@
 VAST_RELAX_WARNINGS
 #include <clang/AST/StmtVisitor.h>
 #include <clang/AST/OperationKinds.h>
+#include <clang/Basic/CodeGenOptions.h>
+#include <mlir/IR/AsmState.h>
+#include <mlir/IR/DialectResourceBlobManager.h>
 VAST_UNRELAX_WARNINGS
 
 #include "vast/CodeGen/CodeGenMeta.hpp"
@@ -21,6 +24,8 @@ VAST_UNRELAX_WARNINGS
 
 #include "vast/Util/Common.hpp"
 
+#include <numeric>
+
 namespace vast::hl {
 
     CastKind cast_kind(const clang::CastExpr *expr);
@@ -41,6 +46,7 @@ namespace vast::cg {
         using lens::derived;
         using lens::context;
         using lens::mcontext;
+        using lens::acontext;
 
         using lens::visit;
         using lens::visit_as_lvalue_type;
@@ -513,7 +519,24 @@ namespace vast::cg {
         // operation VisitCoyieldExpr(const clang::CoyieldExpr *expr)
         // operation VisitDependentCoawaitExpr(const clang::DependentCoawaitExpr *expr)
 
-        // operation VisitAttributedStmt(const clang::AttributedStmt *stmt)
+        // Likelihood attributes are recorded on the enclosing branch or loop
+        // by `with_likelihood`, loop pragmas on the loop they precede by
+        // `with_loop_hints`, other statement attributes are unsupported.
+        operation VisitAttributedStmt(const clang::AttributedStmt *stmt) {
+            auto is_supported = [] (const clang::Attr *attr) {
+                return clang::isa<
+                    clang::LikelyAttr, clang::UnlikelyAttr, clang::LoopHintAttr
+                >(attr);
+            };
+
+            if (!llvm::all_of(stmt->getAttrs(), is_supported)) {
+                return nullptr;
+            }
+
+            auto op = visit(stmt->getSubStmt());
+            with_loop_hints(op, stmt->getAttrs());
+            return op;
+        }
 
         //
         // Cast Operations
@@ -786,7 +809,36 @@ namespace vast::cg {
         operation VisitCaseStmt(const clang::CaseStmt *stmt) {
             auto lhs_builder  = make_value_builder(stmt->getLHS());
             auto body_builder = make_region_builder(stmt->getSubStmt());
-            return make< hl::CaseOp >(meta_location(stmt), lhs_builder, body_builder);
+            auto op = make< hl::CaseOp >(meta_location(stmt), lhs_builder, body_builder);
+
+            auto fold = [&] (const clang::Expr *expr) -> std::optional< llvm::APSInt > {
+                if (expr->isValueDependent())
+                    return std::nullopt;
+                return expr->getIntegerConstantExpr(acontext());
+            };
+
+            auto lhs = stmt->getLHS();
+            auto value = fold(lhs);
+            if (!op || !value) {
+                return op;
+            }
+
+            auto type = visit(lhs->getType());
+            op->setAttr(
+                hl::HighLevelDialect::getCaseValueAttrName(),
+                core::IntegerAttr::get(type, *value)
+            );
+
+            if (auto rhs = stmt->getRHS()) {
+                auto last = fold(rhs);
+                VAST_CHECK(last, "case range end is not a constant");
+                op->setAttr(
+                    hl::HighLevelDialect::getCaseRangeEndAttrName(),
+                    core::IntegerAttr::get(type, *last)
+                );
+            }
+
+            return op;
         }
 
         operation VisitDefaultStmt(const clang::DefaultStmt *stmt) {
@@ -816,13 +868,22 @@ namespace vast::cg {
         operation VisitDoStmt(const clang::DoStmt *stmt) {
             auto cond_builder = make_cond_builder(stmt->getCond());
             auto body_builder = make_region_builder(stmt->getBody());
-            return make< hl::DoOp >(meta_location(stmt), body_builder, cond_builder);
+            return with_progress(
+                make< hl::DoOp >(meta_location(stmt), body_builder, cond_builder),
+                stmt->getCond()
+            );
         }
 
         operation VisitWhileStmt(const clang::WhileStmt *stmt) {
             auto cond_builder = make_cond_builder(stmt->getCond());
             auto body_builder = make_region_builder(stmt->getBody());
-            return make< hl::WhileOp >(meta_location(stmt), cond_builder, body_builder);
+            return with_progress(
+                with_likelihood(
+                    make< hl::WhileOp >(meta_location(stmt), cond_builder, body_builder),
+                    clang::Stmt::getLikelihood(stmt->getBody())
+                ),
+                stmt->getCond()
+            );
         }
 
         // operation VisitCXXCatchStmt(const clang::CXXCatchStmt *stmt)
@@ -837,9 +898,21 @@ namespace vast::cg {
             auto make_loop_op = [&] {
                 auto incr = make_region_builder(stmt->getInc());
                 auto body = make_region_builder(stmt->getBody());
+                auto likelihood = clang::Stmt::getLikelihood(stmt->getBody());
                 if (auto cond = stmt->getCond())
-                    return make< hl::ForOp >(loc, make_cond_builder(cond), incr, body);
-                return make< hl::ForOp >(loc, make_yield_true(), incr, body);
+                    return with_progress(
+                        with_likelihood(
+                            make< hl::ForOp >(loc, make_cond_builder(cond), incr, body),
+                            likelihood
+                        ),
+                        cond
+                    );
+                return with_progress(
+                    with_likelihood(
+                        make< hl::ForOp >(loc, make_yield_true(), incr, body), likelihood
+                    ),
+                    nullptr
+                );
             };
 
             if (stmt->getInit()) {
@@ -865,12 +938,174 @@ namespace vast::cg {
         }
 
         operation VisitIfStmt(const clang::IfStmt *stmt) {
-            return this->template make_operation< hl::IfOp >()
-                .bind(meta_location(stmt))
-                .bind(make_cond_builder(stmt->getCond()))
-                .bind(make_region_builder(stmt->getThen()))
-                .bind_if(stmt->getElse(), make_region_builder(stmt->getElse()))
-                .freeze();
+            return with_likelihood(
+                this->template make_operation< hl::IfOp >()
+                    .bind(meta_location(stmt))
+                    .bind(make_cond_builder(stmt->getCond()))
+                    .bind(make_region_builder(stmt->getThen()))
+                    .bind_if(stmt->getElse(), make_region_builder(stmt->getElse()))
+                    .freeze(),
+                clang::Stmt::getLikelihood(stmt->getThen(), stmt->getElse())
+            );
+        }
+
+        // Marks the then-branch of `hl.if`, or the body of a loop, as likely
+        // or unlikely to be taken.
+        operation with_likelihood(operation op, clang::Stmt::Likelihood likelihood) {
+            if (!op) {
+                return op;
+            }
+
+            switch (likelihood) {
+                case clang::Stmt::LH_Likely:
+                    op->setAttr(hl::LikelyAttr::getMnemonic(), hl::LikelyAttr::get(&mcontext()));
+                    break;
+                case clang::Stmt::LH_Unlikely:
+                    op->setAttr(hl::UnlikelyAttr::getMnemonic(), hl::UnlikelyAttr::get(&mcontext()));
+                    break;
+                case clang::Stmt::LH_None:
+                    break;
+            }
+
+            return op;
+        }
+
+        // Since C11 and C++11, a loop whose condition is not a constant
+        // expression may be assumed to terminate. A missing condition is a
+        // constant. `-ffinite-loops` and `-fno-finite-loops` override the
+        // language rules, same as in clang.
+        bool must_progress(const clang::Expr *cond) {
+            using finite_loops_kind = clang::CodeGenOptions::FiniteLoopsKind;
+            switch (context().finite_loops) {
+                case finite_loops_kind::Always: return true;
+                case finite_loops_kind::Never:  return false;
+                case finite_loops_kind::Language: break;
+            }
+
+            auto &opts = acontext().getLangOpts();
+            if (!opts.C11 && !opts.CPlusPlus11) {
+                return false;
+            }
+
+            return cond && !cond->isValueDependent() && !cond->isEvaluatable(acontext());
+        }
+
+        operation with_progress(operation op, const clang::Expr *cond) {
+            if (!op || !must_progress(cond)) {
+                return op;
+            }
+
+            // Loop pragmas are attached later, by the enclosing attributed
+            // statement.
+            auto &mctx = mcontext();
+            op->setAttr(hl::LoopHintAttr::getMnemonic(), hl::LoopHintAttr::get(&mctx,
+                {}, {}, {}, {}, {}, {}, {}, mlir::BoolAttr::get(&mctx, true)
+            ));
+
+            return op;
+        }
+
+        // Records `#pragma clang loop` and `#pragma unroll` hints on the loop
+        // they precede. Loops with an init statement are the last operation
+        // of their enclosing scope. Unroll-and-jam, pipelining and
+        // predication hints are not represented.
+        void with_loop_hints(operation op, llvm::ArrayRef< const clang::Attr * > attrs) {
+            auto is_hint = [] (const clang::Attr *attr) {
+                return clang::isa< clang::LoopHintAttr >(attr);
+            };
+
+            if (llvm::none_of(attrs, is_hint)) {
+                return;
+            }
+
+            if (auto scope = mlir::dyn_cast_or_null< core::ScopeOp >(op)) {
+                auto &body = scope.getBody();
+                op = body.empty() || body.front().empty() ? nullptr : &body.front().back();
+            }
+
+            if (!mlir::isa_and_nonnull< hl::ForOp, hl::WhileOp, hl::DoOp >(op)) {
+                return;
+            }
+
+            auto &mctx = mcontext();
+            auto hints = op->getAttrOfType< hl::LoopHintAttr >(hl::LoopHintAttr::getMnemonic());
+
+            mlir::BoolAttr vectorize, unroll, unroll_full, distribute, mustprogress;
+            mlir::IntegerAttr vectorize_width, interleave_count, unroll_count;
+            if (hints) {
+                vectorize        = hints.getVectorize();
+                vectorize_width  = hints.getVectorizeWidth();
+                interleave_count = hints.getInterleaveCount();
+                unroll           = hints.getUnroll();
+                unroll_count     = hints.getUnrollCount();
+                unroll_full      = hints.getUnrollFull();
+                distribute       = hints.getDistribute();
+                mustprogress     = hints.getMustprogress();
+            }
+
+            auto flag = [&] (bool value) { return mlir::BoolAttr::get(&mctx, value); };
+
+            auto count = [&] (uint64_t value) {
+                return mlir::IntegerAttr::get(mlir::IntegerType::get(&mctx, 32), value);
+            };
+
+            auto value = [&] (const clang::LoopHintAttr *hint) -> mlir::IntegerAttr {
+                auto expr = hint->getValue();
+                if (!expr || expr->isValueDependent()) {
+                    return {};
+                }
+
+                if (auto result = expr->getIntegerConstantExpr(acontext())) {
+                    return count(result->getZExtValue());
+                }
+
+                return {};
+            };
+
+            for (auto attr : attrs) {
+                auto hint = clang::dyn_cast< clang::LoopHintAttr >(attr);
+                if (!hint) {
+                    continue;
+                }
+
+                auto enabled = hint->getState() != clang::LoopHintAttr::Disable;
+                switch (hint->getOption()) {
+                    case clang::LoopHintAttr::Vectorize:
+                        vectorize = flag(enabled);
+                        break;
+                    case clang::LoopHintAttr::VectorizeWidth:
+                        vectorize_width = value(hint);
+                        break;
+                    case clang::LoopHintAttr::Interleave:
+                        if (!enabled) {
+                            interleave_count = count(1);
+                        }
+                        break;
+                    case clang::LoopHintAttr::InterleaveCount:
+                        interleave_count = value(hint);
+                        break;
+                    case clang::LoopHintAttr::Unroll:
+                        if (hint->getState() == clang::LoopHintAttr::Full) {
+                            unroll_full = flag(true);
+                        } else {
+                            unroll = flag(enabled);
+                        }
+                        break;
+                    case clang::LoopHintAttr::UnrollCount:
+                        unroll_count = value(hint);
+                        break;
+                    case clang::LoopHintAttr::Distribute:
+                        distribute = flag(enabled);
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            op->setAttr(hl::LoopHintAttr::getMnemonic(), hl::LoopHintAttr::get(&mctx,
+                vectorize, vectorize_width, interleave_count, unroll, unroll_count,
+                unroll_full, distribute, mustprogress
+            ));
         }
 
         //
@@ -978,7 +1213,7 @@ namespace vast::cg {
         operation VisitIndirectCall(const clang::CallExpr *expr) {
             auto callee = VisitIndirectCallee(expr->getCallee())->getResult(0);
             auto args   = VisitArguments(expr);
-            auto type   = hl::getFunctionType(callee.getType(), context().mod.get());
+            auto type   = hl::getFunctionType(callee.getType(), context().type_definitions);
             if (type) {
                 return make< hl::IndirectCallOp >(
                     meta_location(expr), type.getResults(), callee, args
@@ -1095,7 +1330,49 @@ namespace vast::cg {
             return VisitScalarLiteral(lit, lit->getValue());
         }
 
+        // Literals of at least this many bytes are stored in resource blobs.
+        static constexpr std::size_t strlit_resource_threshold = 1024;
+
+        // Interns the bytes of the literal (with the terminating zero) into
+        // a dense resource blob.
+        mlir::DenseResourceElementsAttr string_literal_resource(const clang::StringLiteral *lit) {
+            auto arr = acontext().getAsConstantArrayType(lit->getType());
+            if (!arr || lit->getCharByteWidth() != 1) {
+                return {};
+            }
+
+            auto size = arr->getSize().getZExtValue();
+            if (size < strlit_resource_threshold) {
+                return {};
+            }
+
+            std::string bytes = lit->getBytes().str();
+            bytes.resize(size, '\0');
+
+            auto &interned = context().string_literals[bytes];
+            if (!interned) {
+                auto type = mlir::RankedTensorType::get(
+                    { static_cast< std::int64_t >(size) },
+                    mlir::IntegerType::get(&mcontext(), 8)
+                );
+
+                auto blob = mlir::HeapAsmResourceBlob::allocateAndCopyInferAlign(
+                    llvm::ArrayRef< char >(bytes.data(), bytes.size())
+                );
+                interned = mlir::DenseResourceElementsAttr::get(type, "strlit", std::move(blob));
+            }
+
+            return interned;
+        }
+
         operation VisitStringLiteral(const clang::StringLiteral *lit) {
+            if (auto data = string_literal_resource(lit)) {
+                auto type = lit->isLValue() ? visit_as_lvalue_type(lit->getType())
+                                            : visit(lit->getType());
+                auto attr = core::StringLiteralAttr::get(type, data);
+                return make< hl::ConstantOp >(meta_location(lit), type, attr);
+            }
+
             return VisitScalarLiteral(lit, lit->getString());
         }
 
@@ -1103,9 +1380,134 @@ namespace vast::cg {
         // operation VisitCompoundLiteralExpr(const clang::CompoundLiteralExpr *lit)
         // operation VisitFixedPointLiteral(const clang::FixedPointLiteral *lit)
 
+        // Arrays with fewer elements are built element by element to keep
+        // the IR readable.
+        static constexpr std::int64_t dense_initializer_threshold = 16;
+
+        mlir_type dense_element_type(clang::QualType type) {
+            auto &actx = acontext();
+            auto &mctx = mcontext();
+
+            // Booleans are not lowered to integers of their storage size.
+            if (type->isBooleanType()) {
+                return {};
+            }
+
+            if (type->isIntegerType()) {
+                return mlir::IntegerType::get(&mctx, actx.getTypeSize(type));
+            }
+
+            if (type->isRealFloatingType()) {
+                const auto &sema = actx.getFloatTypeSemantics(type);
+                if (&sema == &llvm::APFloat::IEEEsingle())
+                    return mlir::Float32Type::get(&mctx);
+                if (&sema == &llvm::APFloat::IEEEdouble())
+                    return mlir::Float64Type::get(&mctx);
+            }
+
+            return {};
+        }
+
+        // Evaluates a constant array initializer into a dense attribute of
+        // the shape of the array. Returns null attribute if the array is too
+        // small or any of its elements is not a constant scalar.
+        mlir::DenseElementsAttr dense_initializer(const clang::InitListExpr *expr) {
+            auto &actx = acontext();
+
+            llvm::SmallVector< std::int64_t > shape;
+            auto elem = expr->getType();
+            while (auto arr = actx.getAsConstantArrayType(elem)) {
+                shape.push_back(static_cast< std::int64_t >(arr->getSize().getZExtValue()));
+                elem = arr->getElementType();
+            }
+
+            if (shape.empty()) {
+                return {};
+            }
+
+            auto size = std::accumulate(
+                shape.begin(), shape.end(), std::int64_t(1), std::multiplies<>()
+            );
+
+            if (size < dense_initializer_threshold) {
+                return {};
+            }
+
+            auto elem_type = dense_element_type(elem);
+            if (!elem_type) {
+                return {};
+            }
+
+            auto is_float = mlir::isa< mlir::FloatType >(elem_type);
+            auto width    = elem_type.getIntOrFloatBitWidth();
+
+            std::vector< llvm::APInt > ints(is_float ? 0 : size, llvm::APInt(width, 0));
+            std::vector< llvm::APFloat > floats;
+            if (is_float) {
+                floats.assign(size, llvm::APFloat::getZero(actx.getFloatTypeSemantics(elem)));
+            }
+
+            auto evaluate = [&] (const clang::Expr *init, std::int64_t idx) {
+                if (is_float) {
+                    return init->EvaluateAsFloat(floats[idx], actx);
+                }
+
+                clang::Expr::EvalResult result;
+                if (!init->EvaluateAsInt(result, actx)) {
+                    return false;
+                }
+                ints[idx] = result.Val.getInt().extOrTrunc(width);
+                return true;
+            };
+
+            auto collect = [&] (auto &self, const clang::InitListExpr *list,
+                                std::size_t dim, std::int64_t offset) -> bool {
+                if (list->hasArrayFiller()) {
+                    if (!clang::isa< clang::ImplicitValueInitExpr >(list->getArrayFiller())) {
+                        return false;
+                    }
+                }
+
+                auto stride = std::accumulate(
+                    std::next(shape.begin(), dim + 1), shape.end(),
+                    std::int64_t(1), std::multiplies<>()
+                );
+
+                for (auto [idx, init] : llvm::enumerate(list->inits())) {
+                    auto pos = offset + static_cast< std::int64_t >(idx) * stride;
+                    if (dim + 1 < shape.size()) {
+                        auto nested = clang::dyn_cast< clang::InitListExpr >(init);
+                        if (!nested || !self(self, nested, dim + 1, pos)) {
+                            return false;
+                        }
+                    } else if (!evaluate(init, pos)) {
+                        return false;
+                    }
+                }
+
+                return true;
+            };
+
+            if (!collect(collect, expr, 0, 0)) {
+                return {};
+            }
+
+            auto dense_type = mlir::RankedTensorType::get(shape, elem_type);
+            if (is_float) {
+                return mlir::DenseElementsAttr::get(dense_type, floats);
+            }
+            return mlir::DenseElementsAttr::get(dense_type, ints);
+        }
+
         operation VisitInitListExpr(const clang::InitListExpr *expr) {
             auto ty = visit(expr->getType());
 
+            if (auto dense = dense_initializer(expr)) {
+                return make< hl::InitListExpr >(
+                    meta_location(expr), ty, mlir::ValueRange(), dense
+                );
+            }
+
             llvm::SmallVector< Value > elements;
             for (auto elem : expr->inits()) {
                 elements.push_back(visit(elem)->getResult(0));
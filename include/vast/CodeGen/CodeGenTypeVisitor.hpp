@@ -142,6 +142,7 @@ namespace vast::cg {
             clang::Expr *underlying_expr = ty->getUnderlyingExpr();
             auto name = derived().type_of_expr_name(underlying_expr);
 
+            context().types.mark_uncacheable();
             if(!context().typeofexprs.count(ty)) {
                 auto def_op = this->template make_operation< hl::TypeOfExprOp >()
                                   .bind(meta_location(underlying_expr))
@@ -158,6 +159,7 @@ namespace vast::cg {
 
         auto with_qualifiers(const clang::TypeOfType *ty, qualifiers quals) -> mlir_type {
             auto type = visit(ty->getUnmodifiedType());
+            context().types.mark_uncacheable();
             if(!context().typeoftypes.count(ty)) {
                 auto def_op = derived().template create< hl::TypeOfTypeOp >(mlir::UnknownLoc::get(&mcontext()), type);
                 context().typeoftypes.insert(ty, def_op);
@@ -178,6 +180,21 @@ namespace vast::cg {
         }
 
         auto Visit(clang::QualType ty) -> mlir_type {
+            auto &cache = context().types;
+            if (auto cached = cache.lookup(ty)) {
+                return cached;
+            }
+
+            auto generation = cache.generation();
+            auto result = VisitUncached(ty);
+            if (result && generation == cache.generation()) {
+                cache.insert(ty, result);
+            }
+
+            return result;
+        }
+
+        auto VisitUncached(clang::QualType ty) -> mlir_type {
             auto underlying = ty.getTypePtr();
             auto quals      = ty.getLocalQualifiers();
             if (auto t = llvm::dyn_cast< clang::BuiltinType >(underlying)) {
@@ -476,7 +493,11 @@ namespace vast::cg {
         }
 
         auto StoreDataLayout(const clang::Type *orig, mlir_type out) -> mlir_type {
-            if (!orig->isFunctionType() && !is_forward_declared(orig)) {
+            if (is_forward_declared(orig)) {
+                // Layout has to be stored once the type is defined, hence
+                // enclosing types need to be converted again.
+                context().types.mark_uncacheable();
+            } else if (!orig->isFunctionType()) {
                 context().data_layout().try_emplace(out, orig, acontext());
             }
 
@@ -74,6 +74,9 @@ namespace vast::cg
 
         std::optional< clang::GlobalDecl >  lookup_representative_decl(mangled_name_ref name) const;
 
+        // Number of `get_mangled_name` queries answered without mangling.
+        std::size_t avoided_manglings() const { return cached_manglings; }
+
       private:
         std::string mangle(
             clang::GlobalDecl decl, const std::string &module_name_hash
@@ -84,6 +87,8 @@ namespace vast::cg
         // An ordered map of canonical GlobalDecls to their mangled names.
         llvm::MapVector< clang::GlobalDecl, mangled_name_ref > mangled_decl_names;
         llvm::StringMap< clang::GlobalDecl, llvm::BumpPtrAllocator > manglings;
+
+        std::size_t cached_manglings = 0;
     };
 
 } // namespace vast::cg
@@ -65,10 +65,8 @@ namespace vast::conv::abi
 
         // TODO(conv:abi): Figure out how to instead use some generic helper.
         gap::generator< ll::StructGEPOp > field_ptrs(
-            operation root, auto loc, auto &bld
+            operation root, const hl::type_definition_index &defs, auto loc, auto &bld
         ) const {
-            auto module_op = root->getParentOfType< vast_module >();
-            VAST_ASSERT(module_op);
             VAST_ASSERT(root->getNumResults() == 1);
 
             auto trg_type = [&] {
@@ -78,7 +76,8 @@ namespace vast::conv::abi
                 return root_type;
             }();
 
-            auto def = hl::definition_of(trg_type, module_op);
+            auto def = defs.definition_of(trg_type);
+            VAST_CHECK(def, "Was not able to fetch definition of type: {0}", trg_type);
             std::size_t idx = 0;
             for (const auto &[name, type] : def.getFieldsInfo()) {
                 auto ptr_type = hl::PointerType::get(root->getContext(), type);
@@ -143,7 +142,7 @@ namespace vast::conv::abi
         };
 
         state_t &state;
-        vast_module mod;
+        const hl::type_definition_index &defs;
         std::vector< mlir::Value > partials;
 
 
@@ -152,7 +151,7 @@ namespace vast::conv::abi
             auto handle_type = [&](mlir_type field_type) -> mlir::Value
             {
                 if (needs_nesting(field_type))
-                    return self_t(state, mod).run_on(field_type, rewriter);
+                    return self_t(state, defs).run_on(field_type, rewriter);
 
                 state.adjust_by_align(field_type);
 
@@ -161,7 +160,7 @@ namespace vast::conv::abi
                 return state.allocate(field_type, rewriter);
             };
 
-            for (auto field_type : vast::hl::field_types(root_type, mod))
+            for (auto field_type : vast::hl::field_types(root_type, defs))
                 partials.push_back(handle_type(field_type));
 
             // Make the thing;
@@ -178,9 +177,9 @@ namespace vast::conv::abi
 
       public:
 
-        aggregate_reconstructor(state_t &state, vast_module mod)
+        aggregate_reconstructor(state_t &state, const hl::type_definition_index &defs)
             : state(state),
-              mod(mod)
+              defs(defs)
         {}
 
         static state_t mk_state(const pattern &parent, op_t abi_op)
@@ -293,7 +292,7 @@ namespace vast::conv::abi
         };
 
         state_t &state;
-        vast_module mod;
+        const hl::type_definition_index &defs;
         std::vector< mlir::Value > partials;
 
         bool needs_nesting(mlir_type type) const
@@ -311,7 +310,7 @@ namespace vast::conv::abi
                 auto element_type = ptr_type.getElementType();
 
                 if (needs_nesting(element_type))
-                    return self_t(state, mod).run_on(gep.getOperation(), rewriter);
+                    return self_t(state, defs).run_on(gep.getOperation(), rewriter);
 
                 auto rvalue = rewriter.template create< ll::Load >(
                     gep.getLoc(), element_type, gep) ;
@@ -322,14 +321,14 @@ namespace vast::conv::abi
             };
 
             auto loc = root->getLoc();
-            for (auto field_gep : this->field_ptrs(root, loc, rewriter))
+            for (auto field_gep : this->field_ptrs(root, defs, loc, rewriter))
                 handle_field(field_gep);
         }
 
       public:
-        aggregate_deconstructor(state_t &state, vast_module mod)
+        aggregate_deconstructor(state_t &state, const hl::type_definition_index &defs)
             : state(state),
-              mod(mod)
+              defs(defs)
         {}
 
         auto run(operation root, auto &rewriter) &&
@@ -359,10 +358,7 @@ namespace vast::conv::abi
     {
         using deconstructor_t = aggregate_deconstructor< pattern_t, abi_op_t >;
         auto state = deconstructor_t::mk_state(pattern, op);
-
-        auto module_op = op->template getParentOfType< vast_module >();
-        VAST_ASSERT(module_op);
-        return deconstructor_t(state, module_op).run(value, rewriter);
+        return deconstructor_t(state, pattern.defs).run(value, rewriter);
     }
 
     // TODO(conv:abi): This is currently probably too restrained - figure out
@@ -376,10 +372,7 @@ namespace vast::conv::abi
     {
         using reconstructor_t = aggregate_reconstructor< pattern_t, abi_op_t >;
         auto state = reconstructor_t::mk_state(pattern, op);
-
-        auto module_op = op->template getParentOfType< vast_module >();
-        VAST_ASSERT(module_op);
-        return reconstructor_t(state, module_op).run(record_type, rewriter);
+        return reconstructor_t(state, pattern.defs).run(record_type, rewriter);
     }
 
 } // namespace vast::conv::abi
@@ -2,7 +2,28 @@
 
 #pragma once
 
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/ADT/SmallVector.h>
+#include <mlir/IR/Operation.h>
+VAST_UNRELAX_WARNINGS
+
+#include "vast/Dialect/HighLevel/HighLevelDialect.hpp"
+
 namespace vast::conv::abi
 {
     static inline const std::string abi_func_name_prefix = "vast.abi.";
+
+    // Source-level attributes of a function (e.g. `pure` or `returns_nonnull`)
+    // that are carried over to the function that replaces it.
+    static inline auto hl_attrs(mlir::Operation *op) {
+        llvm::SmallVector< mlir::NamedAttribute, 8 > attrs;
+        for (auto attr : op->getAttrs()) {
+            auto &dialect = attr.getValue().getDialect();
+            if (dialect.getNamespace() == hl::HighLevelDialect::getDialectNamespace())
+                attrs.push_back(attr);
+        }
+        return attrs;
+    }
 } // namespace vast::conv::abi
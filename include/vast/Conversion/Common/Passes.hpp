@@ -5,6 +5,7 @@
 #include "vast/Util/Warnings.hpp"
 
 VAST_RELAX_WARNINGS
+#include "mlir/IR/FunctionInterfaces.h"
 #include "mlir/Transforms/DialectConversion.h"
 VAST_UNRELAX_WARNINGS
 
@@ -14,6 +15,22 @@ VAST_UNRELAX_WARNINGS
 
 namespace vast {
 
+    // Function local work of a pass is usually scheduled nested on functions,
+    // so that the pass manager can process them in parallel. The instance of
+    // the pass that runs on the module then needs to visit only operations
+    // that are not functions (e.g., global variables and their initializers).
+    static inline std::vector< operation > non_function_ops(operation root) {
+        std::vector< operation > ops;
+        for (auto &region : root->getRegions()) {
+            for (auto &op : region.getOps()) {
+                if (!mlir::isa< mlir::FunctionOpInterface >(op)) {
+                    ops.push_back(&op);
+                }
+            }
+        }
+        return ops;
+    }
+
     // Inject basic api shared by other mixins:
     //  - iterating over lists of patterns.
     //  - applying the conversion.
@@ -52,6 +69,15 @@ namespace vast {
                                                 std::move(config.patterns));
         }
 
+        // Same as above, but converts only the given `roots` and operations nested in them.
+        template< typename config_t >
+        auto apply_conversions(llvm::ArrayRef< operation > roots, config_t config)
+        {
+            return mlir::applyPartialConversion(roots,
+                                                config.target,
+                                                std::move(config.patterns));
+        }
+
         template< typename ...lists, typename config_t  >
         static void populate_conversions_base(config_t &config) {
             (self_t::template populate_conversions_impl< lists >(config), ...);
@@ -133,12 +159,15 @@ namespace vast {
 
             self().populate_conversions(config);
 
-            if (failed(populate::apply_conversions(std::move(config))))
+            if (failed(populate::apply_conversions(self().conversion_roots(), std::move(config))))
                 return signalPassFailure();
 
             this->after_operation();
         }
 
+        // Override to restrict the conversion only to some of the nested operations.
+        std::vector< operation > conversion_roots() { return { getOperation() }; }
+
         // interface with pass base
         void runOnOperation() override { run_on_operation(); }
 
@@ -223,7 +252,9 @@ namespace vast {
             mlir::LowerToLLVMOptions llvm_options{ &ctx };
             derived_t::set_llvm_opts(llvm_options);
 
-            auto tc = llvm_type_converter(getOperation(), &ctx, llvm_options, &dl_analysis);
+            const auto &defs = this->template getAnalysis< hl::type_definition_index >();
+
+            auto tc = llvm_type_converter(defs, &ctx, llvm_options, &dl_analysis);
             auto cfg = config(
                 rewrite_pattern_set(&ctx), derived_t::create_conversion_target(ctx, tc), tc
             );
@@ -38,9 +38,15 @@ namespace vast
     // Common
     std::unique_ptr< mlir::Pass > createIRsToLLVMPass();
 
+    std::unique_ptr< mlir::Pass > createEmitTBAAPass();
+
+    std::unique_ptr< mlir::Pass > createInferFunctionAttrsPass();
+
     // Core
     std::unique_ptr< mlir::Pass > createCoreToLLVMPass();
 
+    std::unique_ptr< mlir::Pass > createSpeculateLazyPass();
+
     // ABI
     std::unique_ptr< mlir::Pass > createEmitABIPass();
 
@@ -53,8 +59,12 @@ namespace vast
 
     std::unique_ptr< mlir::Pass > createHLToLLVarsPass();
 
+    std::unique_ptr< mlir::Pass > createEmitLifetimeMarkersPass();
+
     std::unique_ptr< mlir::Pass > createHLEmitLazyRegionsPass();
 
+    std::unique_ptr< mlir::Pass > createHLEmitGlobalLazyRegionsPass();
+
     std::unique_ptr< mlir::Pass > createHLToLLFuncPass();
 
     std::unique_ptr< mlir::Pass > createHLToHLBI();
@@ -63,6 +73,8 @@ namespace vast
 
     std::unique_ptr< mlir::Pass > createLowerValueCategoriesPass();
 
+    std::unique_ptr< mlir::Pass > createLowerGlobalValueCategoriesPass();
+
     // Generate the code for registering passes.
     #define GEN_PASS_REGISTRATION
     #include "vast/Conversion/Passes.h.inc"
@@ -71,8 +83,11 @@ namespace vast
     {
         pipeline_step_ptr to_hlbi();
         pipeline_step_ptr abi();
+        pipeline_step_ptr tbaa();
         pipeline_step_ptr irs_to_llvm();
+        pipeline_step_ptr speculation();
         pipeline_step_ptr core_to_llvm();
+        pipeline_step_ptr fn_attrs();
 
         pipeline_step_ptr to_ll();
 
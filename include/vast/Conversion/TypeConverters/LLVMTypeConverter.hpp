@@ -299,11 +299,13 @@ namespace vast::conv::tc {
     {
         using base = LLVMTypeConverter;
 
-        vast_module mod;
+        // Record definitions are resolved using the index, as this is queried
+        // for every converted record type.
+        const hl::type_definition_index &defs;
 
         template< typename... Args >
-        FullLLVMTypeConverter(vast_module mod, Args &&...args)
-            : base(std::forward< Args >(args)...), mod(mod)
+        FullLLVMTypeConverter(const hl::type_definition_index &defs, Args &&...args)
+            : base(std::forward< Args >(args)...), defs(defs)
         {
             addConversion(convert_recordlike< hl::RecordType >());
         }
@@ -312,7 +314,7 @@ namespace vast::conv::tc {
             if (!mlir::isa< hl::RecordType >(t)) {
                 return {};
             }
-            auto def = hl::definition_of(t, mod);
+            auto def = defs.definition_of(t);
             // Nothing found, leave the structure opaque.
             if (!def) {
                 return {};
@@ -22,7 +22,7 @@ VAST_UNRELAX_WARNINGS
 namespace vast::core {
 
     using typed_attrs = util::type_list<
-        BooleanAttr, IntegerAttr, FloatAttr, VoidAttr
+        BooleanAttr, IntegerAttr, FloatAttr, StringLiteralAttr, VoidAttr
     >;
 
 } // namespace vast::core
@@ -67,8 +67,13 @@ namespace vast::core {
             printer, op, fty.getInputs(), fty.isVarArg(), fty.getResults()
         );
 
+        // Argument and result attributes are printed inline with the
+        // signature.
         mlir::function_interface_impl::printFunctionAttributes(
-            printer, op, { getLinkageAttrNameString(), op.getFunctionTypeAttrName() }
+            printer, op, {
+                getLinkageAttrNameString(), op.getFunctionTypeAttrName(),
+                op.getArgAttrsAttrName(), op.getResAttrsAttrName()
+            }
         );
 
         if (!body.empty()) {
@@ -6,6 +6,10 @@
 
 VAST_RELAX_WARNINGS
 #include "mlir/IR/Dialect.h"
+#include "mlir/Dialect/DLTI/DLTI.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/Dialect/PDL/IR/PDL.h"
 VAST_UNRELAX_WARNINGS
 
 #include "vast/Dialect/ABI/ABIDialect.hpp"
@@ -38,4 +42,22 @@ namespace vast {
         mctx.appendDialectRegistry(registry);
     }
 
+    // Upstream dialects that VAST emits or that its passes depend on. Tools
+    // only register them and leave the loading to the parser or to the pass
+    // manager (dependent dialects), instead of loading all upstream dialects.
+    inline void registerDependentDialects(mlir::DialectRegistry &registry) {
+        registry.insert<
+            mlir::DLTIDialect,
+            mlir::LLVM::LLVMDialect,
+            mlir::func::FuncDialect,
+            mlir::pdl::PDLDialect
+        >();
+    }
+
+    inline void registerDependentDialects(mcontext_t &mctx) {
+        mlir::DialectRegistry registry;
+        vast::registerDependentDialects(registry);
+        mctx.appendDialectRegistry(registry);
+    }
+
 } // namespace vast
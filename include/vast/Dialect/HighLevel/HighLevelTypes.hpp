@@ -127,6 +127,14 @@ namespace vast::hl
     core::FunctionType getFunctionType(mlir::CallOpInterface call);
     core::FunctionType getFunctionType(mlir::CallInterfaceCallable callee, vast_module mod);
 
+    struct type_definition_index;
+
+    // Variant of the above that resolves typedefs using the provided index
+    // instead of scanning the module.
+    core::FunctionType getFunctionType(
+        mlir_type function_pointer, const type_definition_index &defs
+    );
+
     mlir_type getTypedefType(TypedefType type, vast_module mod);
 
     // unwraps all typedef aliases to get to real underlying type
@@ -6,6 +6,7 @@
 #include "vast/Dialect/HighLevel/HighLevelDialect.hpp"
 #include "vast/Dialect/HighLevel/HighLevelOps.hpp"
 #include "vast/Dialect/HighLevel/HighLevelTypes.hpp"
+#include "vast/Dialect/HighLevel/TypeDefinitionIndex.hpp"
 #include "vast/Interfaces/SymbolInterface.hpp"
 
 #include "vast/Util/Common.hpp"
@@ -52,6 +53,9 @@ namespace vast::hl {
     // TODO(hl): This is a placeholder that works in our test cases so far.
     //           In general, we will need generic resolution for scoping that
     //           will be used instead of this function.
+    //
+    // Walks the whole `scope`, passes should prefer the overload that takes
+    // `hl::type_definition_index` analysis.
     aggregate_interface definition_of(mlir_type ty, auto scope) {
         auto type_name = hl::name_of_record(ty);
         VAST_CHECK(type_name, "hl::name_of_record failed with {0}", ty);
@@ -68,12 +72,26 @@ namespace vast::hl {
         return out;
     }
 
+    static inline aggregate_interface definition_of(
+        mlir_type ty, const type_definition_index &defs
+    ) {
+        return defs.definition_of(ty);
+    }
+
     gap::generator< mlir_type >  field_types(mlir_type ty, auto scope) {
         auto def = definition_of(ty, scope);
         VAST_CHECK(def, "Was not able to fetch definition of type: {0}", ty);
         return def.getFieldTypes();
     }
 
+    static inline gap::generator< mlir_type > field_types(
+        mlir_type ty, const type_definition_index &defs
+    ) {
+        auto def = defs.definition_of(ty);
+        VAST_CHECK(def, "Was not able to fetch definition of type: {0}", ty);
+        return def.getFieldTypes();
+    }
+
     hl::ImplicitCastOp implicit_cast_lvalue_to_rvalue(auto &rewriter, auto loc, auto lvalue_op) {
         auto value_type = mlir::dyn_cast< hl::LValueType >(lvalue_op.getType());
         VAST_ASSERT(value_type);
@@ -82,6 +100,21 @@ namespace vast::hl {
         );
     }
 
+    // Given record `root` and its definition `def` emit `hl::RecordMemberOp`
+    // for each its member.
+    auto generate_ptrs_to_record_members(
+        operation root, aggregate_interface def, auto loc, auto &bld
+    ) ->  gap::generator< hl::RecordMemberOp > {
+        VAST_CHECK(def, "Was not able to fetch definition of type from: {0}", *root);
+
+        for (const auto &[name, type] : def.getFieldsInfo()) {
+            auto as_val = root->getResult(0);
+            // `hl.member` requires type to be an lvalue.
+            auto wrap_type = hl::LValueType::get(root->getContext(), type);
+            co_yield bld.template create< hl::RecordMemberOp >(loc, wrap_type, as_val, name);
+        }
+    }
+
     // Given record `root` emit `hl::RecordMemberOp` for each its member.
     auto generate_ptrs_to_record_members(operation root, auto loc, auto &bld)
         ->  gap::generator< hl::RecordMemberOp >
@@ -90,14 +123,16 @@ namespace vast::hl {
         VAST_ASSERT(scope);
         VAST_ASSERT(root->getNumResults() == 1);
         auto def = definition_of(root->getResultTypes()[0], scope);
-        VAST_CHECK(def, "Was not able to fetch definition of type from: {0}", *root);
+        return generate_ptrs_to_record_members(root, def, loc, bld);
+    }
 
-        for (const auto &[name, type] : def.getFieldsInfo()) {
-            auto as_val = root->getResult(0);
-            // `hl.member` requires type to be an lvalue.
-            auto wrap_type = hl::LValueType::get(scope.getContext(), type);
-            co_yield bld.template create< hl::RecordMemberOp >(loc, wrap_type, as_val, name);
-        }
+    // Same as above, but resolves the definition using the `defs` index.
+    auto generate_ptrs_to_record_members(
+        operation root, const type_definition_index &defs, auto loc, auto &bld
+    ) ->  gap::generator< hl::RecordMemberOp > {
+        VAST_ASSERT(root->getNumResults() == 1);
+        auto def = defs.definition_of(root->getResultTypes()[0]);
+        return generate_ptrs_to_record_members(root, def, loc, bld);
     }
 
     // Given record `root` emit `hl::RecordMemberOp` casted as rvalue for each
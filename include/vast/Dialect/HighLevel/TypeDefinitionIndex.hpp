@@ -0,0 +1,60 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#pragma once
+
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/ADT/StringMap.h>
+VAST_UNRELAX_WARNINGS
+
+#include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/HighLevel/HighLevelTypes.hpp"
+#include "vast/Interfaces/AggregateTypeDefinitionInterface.hpp"
+
+#include "vast/Util/Common.hpp"
+
+namespace vast::hl {
+
+    //
+    // Index of named type definitions (records, typedefs and enums) of a
+    // module. It is built by a single walk and is meant to be obtained from
+    // the analysis manager, so that all patterns of a pass share it:
+    //
+    //   const auto &defs = getAnalysis< hl::type_definition_index >();
+    //
+    // Lookups resolve to the same definitions as `hl::definition_of` and
+    // `hl::getTypedefType` walks do, but in constant time.
+    //
+    // The index can also be maintained incrementally by inserting definitions
+    // as they are created (e.g., during codegen).
+    //
+    struct type_definition_index
+    {
+        type_definition_index() = default;
+        explicit type_definition_index(operation scope);
+
+        // Registers `op` if it defines a record, typedef or enum.
+        void insert(operation op);
+
+        AggregateTypeDefinitionInterface record(string_ref name) const;
+        TypeDefOp typedef_decl(string_ref name) const;
+        EnumDeclOp enum_decl(string_ref name) const;
+
+        // Looks through value categories and elaborated types. Returns null
+        // interface if the type is not a record or its definition is unknown.
+        AggregateTypeDefinitionInterface definition_of(mlir_type type) const;
+
+        // Counterpart of `hl::getTypedefType`.
+        mlir_type typedef_type(TypedefType type) const;
+
+        // Counterpart of `hl::getBottomTypedefType`.
+        mlir_type bottom_typedef_type(mlir_type type) const;
+
+      private:
+        llvm::StringMap< AggregateTypeDefinitionInterface > records;
+        llvm::StringMap< TypeDefOp > typedefs;
+        llvm::StringMap< EnumDeclOp > enums;
+    };
+
+} // namespace vast::hl
@@ -28,6 +28,9 @@ namespace vast::cc {
 
     struct vast_stream_consumer;
 
+    // default extension of files produced by `act`
+    std::string get_output_stream_suffix(output_type act, const vast_args &vargs);
+
     //
     // Stream action produces the desired output
     // into output stream, created as part of ast consumer
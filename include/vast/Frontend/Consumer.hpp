@@ -12,6 +12,7 @@ VAST_UNRELAX_WARNINGS
 #include "vast/Frontend/Diagnostics.hpp"
 #include "vast/Frontend/FrontendAction.hpp"
 #include "vast/Frontend/Options.hpp"
+#include "vast/Frontend/Stats.hpp"
 #include "vast/Frontend/Targets.hpp"
 
 #include "vast/CodeGen/CodeGenContext.hpp"
@@ -76,6 +77,21 @@ namespace vast::cc {
         std::unique_ptr< mcontext_t > mctx = nullptr;
         std::unique_ptr< cg::codegen_context > cgctx = nullptr;
         std::unique_ptr< cg::codegen_driver > codegen = nullptr;
+
+        //
+        // statistics (-vast-stats)
+        //
+        void write_stats() const;
+
+        compilation_stats_ptr stats = nullptr;
+        compilation_stats::times frontend_start;
+
+        //
+        // trace (-vast-trace)
+        //
+        void write_trace() const;
+
+        trace::recorder_ptr tracer = nullptr;
     };
 
     struct vast_stream_consumer : vast_consumer {
@@ -90,6 +106,8 @@ namespace vast::cc {
         void HandleTranslationUnit(acontext_t &acontext) override;
 
       private:
+        void emit_output(owning_module_ref mod);
+
         void emit_backend_output(
             backend backend_action, owning_module_ref mlir_module, mcontext_t *mctx
         );
@@ -98,6 +116,8 @@ namespace vast::cc {
             target_dialect target, owning_module_ref mod, mcontext_t *mctx
         );
 
+        void emit_mlir_bytecode(vast_module mod);
+
         void process_mlir_module(
             target_dialect target, mlir::ModuleOp mod, mcontext_t *mctx
         );
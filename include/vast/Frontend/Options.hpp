@@ -73,10 +73,21 @@ namespace vast::cc
         constexpr string_ref emit_asm  = "emit-asm";
         constexpr string_ref emit_mlir = "emit-mlir";
 
+        // -vast-emit-mlir-bytecode[=version] switches -vast-emit-mlir output
+        // to MLIR bytecode, optionally pinned to the given bytecode version
+        constexpr string_ref emit_mlir_bytecode = "emit-mlir-bytecode";
+
         constexpr string_ref print_pipeline = "print-pipeline";
+        constexpr string_ref stats = "stats";
+        constexpr string_ref trace = "trace";
         constexpr string_ref emit_crash_reproducer = "emit-crash-reproducer";
 
         constexpr string_ref disable_multithreading = "disable-multithreading";
+
+        // -vast-batch=<compile_commands.json> compiles all translation units of
+        // the compilation database in a single process
+        constexpr string_ref batch = "batch";
+        constexpr string_ref batch_threads = "batch-threads";
         constexpr string_ref debug = "debug";
 
         constexpr string_ref simplify = "simplify";
@@ -92,6 +103,7 @@ namespace vast::cc
 
         bool emit_only_mlir(const vast_args &vargs);
         bool emit_only_llvm(const vast_args &vargs);
+        bool emit_bytecode(const vast_args &vargs);
     } // namespace opt
 
     using source_language = core::SourceLanguage;
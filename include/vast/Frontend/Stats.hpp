@@ -0,0 +1,111 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#pragma once
+
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Support/raw_ostream.h>
+#include <mlir/Pass/PassManager.h>
+VAST_UNRELAX_WARNINGS
+
+#include "vast/Util/Common.hpp"
+
+#include <map>
+#include <mutex>
+#include <optional>
+
+namespace vast::cc {
+
+    //
+    // Statistics of a single compilation requested by -vast-stats=<file.json>:
+    //
+    //  - wall and CPU time of frontend phases (clang parse, codegen, LLVM
+    //    translation, backend, ...),
+    //  - wall and CPU time of each pass of the vast pipeline together with
+    //    number of operations per dialect before and after the pass,
+    //  - counters of codegen caches (type conversions, name mangling),
+    //  - peak resident set size of the process.
+    //
+    // CPU times are process times, hence with multithreaded pass execution
+    // they also include work of other threads running at the same time.
+    //
+    struct compilation_stats
+    {
+        struct times {
+            double wall = 0.0;
+            double cpu  = 0.0;
+
+            times &operator+=(const times &other);
+            times &operator-=(const times &other);
+
+            static times now();
+        };
+
+        using op_counts = llvm::StringMap< std::uint64_t >;
+
+        //
+        // Accumulates time spent in the scope into phase `name`. Scope with
+        // null stats does nothing, so that it can be used unconditionally.
+        //
+        struct phase_scope {
+            phase_scope(compilation_stats *stats, string_ref name);
+            ~phase_scope();
+
+            phase_scope(const phase_scope &) = delete;
+            phase_scope &operator=(const phase_scope &) = delete;
+
+          private:
+            compilation_stats *stats;
+            std::string name;
+            times start;
+        };
+
+        void add_phase(string_ref name, const times &time);
+        times phase_time(string_ref name) const;
+
+        // Accumulates `value` into counter `name`.
+        void add_counter(string_ref name, std::uint64_t value);
+
+        // Records every pass run by `pm`.
+        void instrument(mlir::PassManager &pm);
+
+        void write(llvm::raw_ostream &os) const;
+        logical_result write(string_ref path) const;
+
+      private:
+        friend struct stats_instrumentation;
+
+        struct pass_record {
+            std::string name;
+            std::string anchor;
+            std::uint64_t runs = 0;
+            times time;
+            op_counts ops_before;
+            op_counts ops_after;
+        };
+
+        pass_record &record(const mlir::Pass *pass, operation op);
+
+        // kept in order of the first occurrence
+        std::vector< std::pair< std::string, times > > phases;
+        std::vector< std::pair< std::string, std::uint64_t > > counters;
+
+        // MLIR clones pipelines nested on functions for each worker thread,
+        // records are keyed by the pass argument and the anchor operation,
+        // so that the clones of a pass share a single record.
+        std::vector< pass_record > passes;
+        std::map< std::pair< std::string, std::string >, std::size_t > pass_index;
+
+        // passes nested on functions run concurrently
+        std::mutex passes_mutex;
+    };
+
+    using compilation_stats_ptr = std::unique_ptr< compilation_stats >;
+
+    // Peak resident set size of the process in bytes, if known.
+    std::optional< std::uint64_t > peak_rss();
+
+} // namespace vast::cc
@@ -5,6 +5,8 @@
 #include "vast/Util/Common.hpp"
 
 VAST_RELAX_WARNINGS
+#include <llvm/ADT/DenseMap.h>
+#include <mlir/IR/IRMapping.h>
 #include <mlir/Pass/PassManager.h>
 VAST_UNRELAX_WARNINGS
 
@@ -75,4 +77,78 @@ namespace vast::tw {
 
     using default_tower = tower< default_loc_rewriter_t >;
 
+    //
+    // Tower that keeps stages as copy-on-write snapshots. Each snapshot owns
+    // only the top-level operations that were changed by the applied passes,
+    // unchanged operations are shared with the snapshot they come from.
+    //
+    // Provenance of operations is recorded in a side table of each snapshot
+    // instead of being kept in their locations. Passes run on a working copy
+    // whose locations are tagged with the source operations, so that the
+    // operations created by rewrites inherit the tag of the operation they
+    // replace. The tags are stripped right after the passes finish.
+    //
+    struct snapshot_tower
+    {
+        struct handle_t
+        {
+            std::size_t id;
+        };
+
+        static auto get(mcontext_t &ctx, owning_module_ref mod)
+            -> std::tuple< snapshot_tower, handle_t >;
+
+        auto apply(handle_t handle, mlir::PassManager &pm) -> handle_t;
+        auto apply(handle_t handle, pass_ptr_t pass) -> handle_t;
+
+        auto top() const -> handle_t { return { _snapshots.size() - 1 }; }
+
+        auto size() const -> std::size_t { return _snapshots.size(); }
+
+        auto parent(handle_t handle) const -> handle_t {
+            return { _snapshots[handle.id].parent };
+        }
+
+        // Top-level operations of the snapshot in module order.
+        auto ops(handle_t handle) const -> llvm::ArrayRef< operation > {
+            return _snapshots[handle.id].layout;
+        }
+
+        // Number of top-level operations stored by the snapshot itself.
+        auto owned_ops(handle_t handle) const -> std::size_t;
+
+        // Builds a standalone module of the snapshot.
+        auto materialize(handle_t handle) const -> owning_module_ref;
+
+        // Returns the operation of the parent snapshot `op` was derived from,
+        // or null if `op` was created by the passes. `op` has to be an
+        // operation reachable from `ops(handle)`.
+        auto prev(handle_t handle, operation op) const -> operation;
+
+        // Makes the snapshot own the top-level operation enclosing `op`, so
+        // that it can be modified without affecting other snapshots. Returns
+        // the copy of `op` if the enclosing operation was shared.
+        auto own(handle_t handle, operation op) -> operation;
+
+      private:
+        struct snapshot_t
+        {
+            // Holds the changed top-level operations and module attributes.
+            owning_module_ref storage;
+            std::vector< operation > layout;
+            llvm::DenseMap< operation, operation > provenance;
+            std::size_t parent;
+        };
+
+        auto materialize(const snapshot_t &snapshot, mlir::IRMapping &mapping) const
+            -> owning_module_ref;
+
+        auto owns(const snapshot_t &snapshot, operation op) const -> bool;
+
+        mcontext_t *_ctx;
+        std::vector< snapshot_t > _snapshots;
+
+        snapshot_tower(mcontext_t &ctx, owning_module_ref mod);
+    };
+
 } // namespace vast::tw
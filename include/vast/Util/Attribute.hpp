@@ -2,6 +2,12 @@
 
 #pragma once
 
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/ADT/STLExtras.h>
+VAST_UNRELAX_WARNINGS
+
 namespace vast::util
 {
     template< typename attribute_type >
@@ -14,4 +20,13 @@ namespace vast::util
         return op->hasAttr(attribute_type::getMnemonic());
     }
 
+    // Looks up the attribute regardless of its name, source attributes are
+    // stored under their spelling (e.g. `hl::RestrictAttr` under `malloc`).
+    template< typename attribute_type >
+    bool has_attr_of_type(auto op) {
+        return llvm::any_of(op->getAttrs(), [] (auto attr) {
+            return mlir::isa< attribute_type >(attr.getValue());
+        });
+    }
+
 } // namespace vast::util
@@ -0,0 +1,69 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#pragma once
+
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+#include <mlir/Bytecode/BytecodeReader.h>
+VAST_UNRELAX_WARNINGS
+
+#include "vast/Util/Common.hpp"
+
+#include <memory>
+#include <optional>
+
+namespace vast {
+
+    using memory_buffer_ptr = std::unique_ptr< llvm::MemoryBuffer >;
+
+    // The first bytecode version that stores bodies of isolated operations
+    // (functions) in separately loadable sections.
+    constexpr std::int64_t min_lazy_bytecode_version = 2;
+
+    // Writes `op` as MLIR bytecode. When `version` is not given the latest
+    // version supported by the linked MLIR is emitted. Versions older than
+    // `min_lazy_bytecode_version` are rejected.
+    logical_result write_bytecode(
+        operation op, llvm::raw_ostream &os, std::optional< std::int64_t > version = std::nullopt
+    );
+
+    bool is_bytecode(const llvm::MemoryBuffer &buffer);
+
+    //
+    // Reads a module from either textual MLIR or bytecode. Bodies of bytecode
+    // functions are left unmaterialized until `materialize` is requested for
+    // them, so that opening a large module does not load every function.
+    //
+    // The reader owns the input buffer and has to outlive the module it returns.
+    //
+    struct module_reader
+    {
+        explicit module_reader(mcontext_t *mctx, bool lazy = true);
+
+        owning_module_ref read(memory_buffer_ptr buffer);
+
+        // Loads the body of `op` and of all operations nested in it.
+        logical_result materialize(operation op);
+
+        // Loads bodies of all not yet materialized operations.
+        logical_result materialize_all();
+
+        bool is_materializable(operation op);
+
+        llvm::SourceMgr &source_manager() { return *source_mgr; }
+
+      private:
+        owning_module_ref read_bytecode(llvm::MemoryBufferRef buffer);
+
+        mcontext_t *mctx;
+        bool lazy;
+
+        std::shared_ptr< llvm::SourceMgr > source_mgr;
+        std::unique_ptr< mlir::BytecodeReader > reader;
+    };
+
+} // namespace vast
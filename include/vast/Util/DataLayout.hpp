@@ -112,6 +112,10 @@ namespace vast::dl {
     struct DataLayoutBlueprint
     {
         bool try_emplace(mlir_type mty, const clang::Type *aty, const acontext_t &actx) {
+            if (entries.contains(mty)) {
+                return false;
+            }
+
             // For other types this should be good-enough for now
             auto info      = actx.getTypeInfo(aty);
             auto bw        = static_cast< uint32_t >(info.Width);
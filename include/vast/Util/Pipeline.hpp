@@ -40,11 +40,16 @@ namespace vast {
     // pipeline is a pass manager, which keeps track of duplicit passes and does
     // not schedule them twice
     //
+    // Passes are deduplicated per anchor operation, so the same pass can be
+    // scheduled nested on functions and once more on the whole module.
+    //
     struct pipeline_t : mlir::PassManager
     {
         using base      = mlir::PassManager;
         using pass_id_t = mlir::TypeID;
 
+        using scheduled_pass_t = std::pair< pass_id_t, string_ref >;
+
         using base::base;
 
         virtual ~pipeline_t() = default;
@@ -53,19 +58,21 @@ namespace vast {
 
         template< typename parent_t >
         void addNestedPass(std::unique_ptr< mlir::Pass > pass) {
-            auto id = pass->getTypeID();
-            if (seen.count(id)) {
+            auto key = scheduled_pass_t{ pass->getTypeID(), parent_t::getOperationName() };
+            if (seen.count(key)) {
                 return;
             }
 
-            seen.insert(id);
-            VAST_PIPELINE_DEBUG("scheduling nested pass: {0}", pass->getName());
+            seen.insert(key);
+            VAST_PIPELINE_DEBUG(
+                "scheduling nested pass: {0} on {1}", pass->getName(), key.second
+            );
             base::addNestedPass< parent_t >(std::move(pass));
         }
 
         virtual void schedule(pipeline_step_ptr step) = 0;
 
-        llvm::DenseSet< pass_id_t > seen;
+        llvm::DenseSet< scheduled_pass_t > seen;
     };
 
 
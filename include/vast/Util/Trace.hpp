@@ -0,0 +1,80 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#pragma once
+
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/ADT/STLFunctionalExtras.h>
+#include <llvm/Support/raw_ostream.h>
+#include <mlir/Pass/PassManager.h>
+VAST_UNRELAX_WARNINGS
+
+#include "vast/Util/Common.hpp"
+
+#include <chrono>
+#include <mutex>
+
+namespace vast::trace {
+
+    using clock = std::chrono::steady_clock;
+
+    struct event {
+        std::string category;
+        std::string name;
+        std::string detail;
+        clock::time_point start;
+        clock::duration duration;
+        std::uint64_t thread;
+    };
+
+    //
+    // Collects spans of a compilation and writes them as Chrome trace-event
+    // JSON (viewable in chrome://tracing or Perfetto). Each span remembers the
+    // thread it ran on, so multithreaded work shows up in per-thread lanes.
+    //
+    // Recording is thread-safe.
+    //
+    struct recorder
+    {
+        recorder() : origin(clock::now()) {}
+
+        void record(event &&ev);
+
+        void write(llvm::raw_ostream &os) const;
+        logical_result write(string_ref path) const;
+
+        // Records a span for each pass run by `pm`. Passes nested on functions
+        // are recorded per function, nested in the span of their adaptor.
+        void instrument(mlir::PassManager &pm);
+
+      private:
+        clock::time_point origin;
+
+        mutable std::mutex mutex;
+        std::vector< event > events;
+    };
+
+    using recorder_ptr = std::unique_ptr< recorder >;
+
+    //
+    // Records the span of its lifetime. Scope with null recorder does
+    // nothing, so that it can be used unconditionally.
+    //
+    struct scope
+    {
+        using detail_builder = llvm::function_ref< std::string() >;
+
+        scope(recorder *rec, string_ref category, string_ref name);
+        scope(recorder *rec, string_ref category, string_ref name, detail_builder detail);
+        ~scope();
+
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+      private:
+        recorder *rec;
+        event ev;
+    };
+
+} // namespace vast::trace
@@ -52,7 +52,7 @@ namespace vast::repl
         struct string_param  { std::string value; };
         struct integer_param { std::uint64_t value; };
 
-        enum class show_kind { source, ast, module, symbols };
+        enum class show_kind { source, ast, module, symbols, snapshots, provenance };
 
         template< typename enum_type >
         enum_type from_string(string_ref token) requires(std::is_same_v< enum_type, show_kind >) {
@@ -60,6 +60,8 @@ namespace vast::repl
             if (token == "ast")     return enum_type::ast;
             if (token == "module")  return enum_type::module;
             if (token == "symbols") return enum_type::symbols;
+            if (token == "snapshots")  return enum_type::snapshots;
+            if (token == "provenance") return enum_type::provenance;
             VAST_FATAL("uknnown show kind: {0}", token.str());
         }
 
@@ -17,7 +17,7 @@ namespace vast::repl {
         std::optional< std::filesystem::path > source;
 
         mcontext_t &ctx;
-        std::optional< tw::default_tower > tower;
+        std::optional< tw::snapshot_tower > tower;
     };
 
 } // namespace vast::repl
@@ -87,6 +87,8 @@ namespace vast::cg
         if (deferred_inline_member_func_defs.empty())
             return;
 
+        trace::scope span(tracer, "codegen", "deferred inline methods");
+
         // Emit any deferred inline method definitions. Note that more deferred
         // methods may be added during this loop, since ASTConsumer callbacks can be
         // invoked if AST inspection results in declarations being added.
@@ -110,11 +112,22 @@ namespace vast::cg
         }
     }
 
+    static std::string decl_name(const clang::Decl *decl) {
+        if (auto named = llvm::dyn_cast< clang::NamedDecl >(decl)) {
+            return named->getQualifiedNameAsString();
+        }
+        return {};
+    }
+
     void codegen_driver::handle_top_level_decl(clang::Decl *decl) {
         // Ignore dependent declarations
         if (decl->isTemplated())
             return;
 
+        trace::scope span(tracer, "codegen", decl->getDeclKindName(), [&] {
+            return decl_name(decl);
+        });
+
         // Consteval function shouldn't be emitted.
         if (auto *fn = llvm::dyn_cast< clang::FunctionDecl >(decl)) {
             if (fn->isConsteval()) {
@@ -345,6 +358,8 @@ namespace vast::cg
             return;
         }
 
+        trace::scope span(tracer, "codegen", "deferred decls");
+
         // Grab the list of decls to emit. If build_global_definition schedules more
         // work, it will not interfere with this.
         auto curr_decls_to_emit = cgctx.receive_deferred_decls_to_emit();
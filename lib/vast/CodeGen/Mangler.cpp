@@ -9,6 +9,12 @@ namespace vast::cg
     ) {
         auto canonical = decl.getCanonicalDecl();
 
+        // Reuse the name if the decl was already mangled.
+        if (auto it = mangled_decl_names.find(canonical); it != mangled_decl_names.end()) {
+            ++cached_manglings;
+            return it->second;
+        }
+
         // Some ABIs don't have constructor variants. Make sure that base and complete
         // constructors get mangled the same.
         if (const auto *ctor = clang::dyn_cast< clang::CXXConstructorDecl >(canonical.getDecl())) {
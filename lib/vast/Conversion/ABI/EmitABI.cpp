@@ -220,12 +220,34 @@ namespace vast
 
             using types_t = std::vector< mlir::Type >;
 
+            // Facts recorded about a parameter hold only for an argument passed
+            // as is. Arguments split, coerced or passed indirectly get none.
+            mlir::SmallVector< mlir::DictionaryAttr, 8 > abified_arg_attrs()
+            {
+                mlir::SmallVector< mlir::DictionaryAttr, 8 > out;
+                auto none = mlir::DictionaryAttr::get(op.getContext());
+
+                for (auto [idx, e] : llvm::enumerate(abi_info.args()))
+                {
+                    auto trgs = e.target_types();
+                    if (std::holds_alternative< abi::direct >(e.style) && trgs.size() == 1)
+                    {
+                        auto facts = op.getArgAttrDict(unsigned(idx));
+                        out.push_back(facts ? facts : none);
+                        continue;
+                    }
+
+                    out.append(trgs.size(), none);
+                }
+
+                return out;
+            }
+
             abi::FuncOp make()
             {
-                mlir::SmallVector< mlir::DictionaryAttr, 8 > arg_attrs;
-                mlir::SmallVector< mlir::NamedAttribute, 8 > other_attrs;
+                auto arg_attrs = abified_arg_attrs();
+                auto other_attrs = conv::abi::hl_attrs(op);
 
-                op.getAllArgAttrs(arg_attrs);
                 auto wrapper = rewriter.template create< abi::FuncOp >(
                         op.getLoc(),
                         // Temporal, to avoid verification issues, will be changed once
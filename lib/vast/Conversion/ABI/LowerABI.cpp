@@ -85,11 +85,13 @@ namespace vast
             using op_t = Op;
 
             const mlir::DataLayout &dl;
+            const hl::type_definition_index &defs;
 
             template< typename ... Args >
-            abi_pattern_base(const mlir::DataLayout &dl, Args && ... args)
+            abi_pattern_base(const mlir::DataLayout &dl, const hl::type_definition_index &defs,
+                             Args && ... args)
                 : base(std::forward< Args >(args) ...),
-                  dl(dl)
+                  dl(dl), defs(defs)
             {}
 
             using state_capture = match_and_rewrite_state_capture< op_t >;
@@ -568,8 +570,10 @@ namespace vast
                                            typename op_t::Adaptor ops,
                                            conversion_rewriter &rewriter) const override
             {
+                // Argument attributes were already remapped to the ABI
+                // arguments by `EmitABI`, the signature does not change here.
                 mlir::SmallVector< mlir::DictionaryAttr, 8 > arg_attrs;
-                mlir::SmallVector< mlir::NamedAttribute, 8 > other_attrs;
+                auto other_attrs = conv::abi::hl_attrs(op);
 
                 op.getAllArgAttrs(arg_attrs);
 
@@ -618,13 +622,13 @@ namespace vast
             return target;
         }
 
-        void add_patterns(auto &config, const auto &dl)
+        void add_patterns(auto &config, const auto &dl, const auto &defs)
         {
-            config.patterns.template add< pattern::prologue >(dl, config.getContext());
-            config.patterns.template add< pattern::epilogue >(dl, config.getContext());
+            config.patterns.template add< pattern::prologue >(dl, defs, config.getContext());
+            config.patterns.template add< pattern::epilogue >(dl, defs, config.getContext());
 
-            config.patterns.template add< pattern::call_args >(dl, config.getContext());
-            config.patterns.template add< pattern::call_rets >(dl, config.getContext());
+            config.patterns.template add< pattern::call_args >(dl, defs, config.getContext());
+            config.patterns.template add< pattern::call_rets >(dl, defs, config.getContext());
 
             config.patterns.template add< pattern::call >(config.getContext());
             config.patterns.template add< pattern::call_exec >(config.getContext());
@@ -658,7 +662,9 @@ namespace vast
             const auto &dl_analysis = this->template getAnalysis< mlir::DataLayoutAnalysis >();
             auto dl = dl_analysis.getAtOrAbove(op);
 
-            add_patterns(config, dl);
+            const auto &defs = this->template getAnalysis< hl::type_definition_index >();
+
+            add_patterns(config, dl, defs);
 
             if (mlir::failed(base::apply_conversions(std::move(config))))
                 return signalPassFailure();
@@ -21,14 +21,36 @@ namespace vast::conv::pipeline {
             .depends_on(core_to_llvm);
     }
 
+    static pipeline_step_ptr speculate_lazy() {
+        return nested< mlir::LLVM::LLVMFuncOp >(createSpeculateLazyPass)
+            .depends_on(irs_to_llvm);
+    }
+
+    // Named step, so that speculation can be turned off by
+    // `-vast-disable-speculation`.
+    pipeline_step_ptr speculation() {
+        return compose("speculation", speculate_lazy);
+    }
+
     pipeline_step_ptr core_to_llvm() {
         // TODO add dependencies
         return pass(createCoreToLLVMPass)
             .depends_on(to_ll, irs_to_llvm);
     }
 
+    static pipeline_step_ptr infer_fn_attrs() {
+        return pass(createInferFunctionAttrsPass)
+            .depends_on(core_to_llvm);
+    }
+
+    pipeline_step_ptr fn_attrs() {
+        return compose("fn-attrs", infer_fn_attrs);
+    }
+
     pipeline_step_ptr to_llvm() {
-        return compose("to-llvm", irs_to_llvm, core_to_llvm, llvm_debug_scope);
+        return compose(
+            "to-llvm", tbaa, irs_to_llvm, speculation, core_to_llvm, fn_attrs, llvm_debug_scope
+        );
     }
 
 } // namespace vast::conv::pipeline
@@ -0,0 +1,249 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Conversion/Passes.hpp"
+
+VAST_RELAX_WARNINGS
+#include <mlir/Dialect/LLVMIR/LLVMDialect.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/Interfaces/SideEffectInterfaces.h>
+
+#include <llvm/ADT/TypeSwitch.h>
+VAST_UNRELAX_WARNINGS
+
+#include "../PassesDetails.hpp"
+
+#include "vast/Dialect/Core/CoreOps.hpp"
+#include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+
+#include "vast/Util/Common.hpp"
+
+namespace vast::conv
+{
+    namespace LLVM = mlir::LLVM;
+
+    namespace
+    {
+        // Division by zero is undefined, even though LLVM considers the
+        // operations pure.
+        bool may_trap(operation op) {
+            return mlir::isa< LLVM::SDivOp, LLVM::UDivOp, LLVM::SRemOp, LLVM::URemOp >(op);
+        }
+
+        // Local variables are allocated at the function entry, their loads
+        // cannot trap.
+        bool is_local_load(operation op) {
+            auto load = mlir::dyn_cast< LLVM::LoadOp >(op);
+            return load
+                && !load.getVolatile_()
+                && load.getOrdering() == LLVM::AtomicOrdering::not_atomic
+                && load.getAddr().getDefiningOp< LLVM::AllocaOp >();
+        }
+
+        bool is_speculatable(operation op) {
+            return is_local_load(op) || (mlir::isPure(op) && !may_trap(op));
+        }
+
+        bool is_integer(mlir_type type) { return mlir::isa< mlir::IntegerType >(type); }
+
+        hl::ValueYieldOp lazy_yield(core::LazyOp lazy) {
+            auto &region = lazy.getLazy();
+            if (!region.hasOneBlock() || region.front().empty()) {
+                return {};
+            }
+            return mlir::dyn_cast< hl::ValueYieldOp >(region.front().back());
+        }
+
+        // Cost of the eager evaluation of a lazy operand, or `std::nullopt` if
+        // the operand cannot be evaluated eagerly.
+        std::optional< unsigned > speculation_cost(core::LazyOp lazy) {
+            if (!lazy_yield(lazy)) {
+                return std::nullopt;
+            }
+
+            unsigned cost = 0;
+            for (auto &op : lazy.getLazy().front()) {
+                if (mlir::isa< hl::ValueYieldOp >(op)) {
+                    continue;
+                }
+
+                if (!is_speculatable(&op)) {
+                    return std::nullopt;
+                }
+
+                if (!mlir::isa< LLVM::ConstantOp >(op)) {
+                    ++cost;
+                }
+            }
+
+            return cost;
+        }
+
+        // Lazy operands are emitted in the block of their user, to which
+        // their regions can be spliced.
+        core::LazyOp lazy_operand(mlir_value val, operation user) {
+            auto lazy = val.getDefiningOp< core::LazyOp >();
+            if (!lazy || lazy->getBlock() != user->getBlock() || !lazy_yield(lazy)) {
+                return {};
+            }
+            return lazy;
+        }
+
+        // Moves the operations of the lazy region in front of `user` and
+        // returns the yielded value. The emptied lazy operation is left to be
+        // erased once unused.
+        mlir_value inline_before(core::LazyOp lazy, operation user) {
+            auto yield = lazy_yield(lazy);
+            auto value = yield.getResult();
+            yield->erase();
+
+            auto &ops = lazy.getLazy().front().getOperations();
+            user->getBlock()->getOperations().splice(user->getIterator(), ops);
+            return value;
+        }
+
+        mlir_value to_bool(mlir::OpBuilder &bld, mlir::Location loc, mlir_value val) {
+            auto type = mlir::cast< mlir::IntegerType >(val.getType());
+            if (type.getWidth() == 1) {
+                return val;
+            }
+
+            auto zero = bld.create< LLVM::ConstantOp >(loc, type, bld.getIntegerAttr(type, 0));
+            return bld.create< LLVM::ICmpOp >(loc, LLVM::ICmpPredicate::ne, val, zero);
+        }
+
+        mlir_value from_bool(mlir::OpBuilder &bld, mlir::Location loc, mlir_value val, mlir_type type) {
+            if (val.getType() == type) {
+                return val;
+            }
+            return bld.create< LLVM::ZExtOp >(loc, type, val);
+        }
+
+        void replace(operation op, mlir_value value, llvm::ArrayRef< core::LazyOp > lazy_ops) {
+            op->getResult(0).replaceAllUsesWith(value);
+            op->erase();
+            for (auto lazy : lazy_ops) {
+                lazy->erase();
+            }
+        }
+
+    } // namespace
+
+    //
+    // Logical operators and the conditional operator evaluate their operands
+    // lazily, which is lowered to control flow by `vast-core-to-llvm`. Cheap
+    // operands without side effects are evaluated eagerly instead, so that
+    // LLVM gets straight-line code:
+    //
+    //   a && b  ->  zext(select(a != 0, b != 0, false))
+    //   a || b  ->  zext(select(a != 0, true, b != 0))
+    //   c ? a : b  ->  select(c != 0, a, b)
+    //
+    // The logical operators are not lowered to `and` and `or`, because the
+    // eagerly evaluated right-hand side may be poison (e.g. `n < 32 && x << n`)
+    // and bitwise operations would propagate it even when the left-hand side
+    // decides the result. `select` does not propagate poison of the operand
+    // it does not choose.
+    //
+    // The left-hand side of logical operators is always evaluated, hence only
+    // the right-hand side counts towards the threshold. Both arms of the
+    // conditional operator count.
+    //
+    struct SpeculateLazyPass : SpeculateLazyBase< SpeculateLazyPass >
+    {
+        void runOnOperation() override {
+            // Post-order, so that nested operators are speculated first and
+            // do not block speculation of the enclosing ones.
+            std::vector< operation > ops;
+            getOperation()->walk([&] (operation op) {
+                if (mlir::isa< core::BinLAndOp, core::BinLOrOp, core::SelectOp >(op)) {
+                    ops.push_back(op);
+                }
+            });
+
+            for (auto op : ops) {
+                llvm::TypeSwitch< operation >(op)
+                    .Case([&] (core::BinLAndOp land) { speculate(land); })
+                    .Case([&] (core::BinLOrOp lor) { speculate(lor); })
+                    .Case([&] (core::SelectOp select) { speculate(select); });
+            }
+        }
+
+        bool within_threshold(std::optional< unsigned > cost) const {
+            return cost && *cost <= cost_threshold;
+        }
+
+        template< typename logical_op >
+        void speculate(logical_op op) {
+            auto lhs = lazy_operand(op.getLhs(), op);
+            auto rhs = lazy_operand(op.getRhs(), op);
+            if (!lhs || !rhs || !is_integer(op.getType())) {
+                return;
+            }
+
+            if (!is_integer(lhs.getType()) || !is_integer(rhs.getType())) {
+                return;
+            }
+
+            if (!within_threshold(speculation_cost(rhs))) {
+                return;
+            }
+
+            auto loc = op.getLoc();
+            mlir::OpBuilder bld(op);
+
+            auto lhs_val = to_bool(bld, loc, inline_before(lhs, op));
+            auto rhs_val = to_bool(bld, loc, inline_before(rhs, op));
+
+            auto i1 = bld.getI1Type();
+            auto constant = [&] (bool value) -> mlir_value {
+                return bld.create< LLVM::ConstantOp >(loc, i1, bld.getIntegerAttr(i1, value));
+            };
+
+            constexpr bool is_land = std::is_same_v< logical_op, core::BinLAndOp >;
+            auto result = is_land
+                ? bld.create< LLVM::SelectOp >(loc, i1, lhs_val, rhs_val, constant(false))
+                : bld.create< LLVM::SelectOp >(loc, i1, lhs_val, constant(true), rhs_val);
+            replace(op, from_bool(bld, loc, result, op.getType()), { lhs, rhs });
+        }
+
+        void speculate(core::SelectOp op) {
+            if (op.getNumResults() != 1) {
+                return;
+            }
+
+            auto cond = op.getCond();
+            auto lhs  = lazy_operand(op.getThenRegion(), op);
+            auto rhs  = lazy_operand(op.getElseRegion(), op);
+            if (!lhs || !rhs || !is_integer(cond.getType())) {
+                return;
+            }
+
+            auto result_type = op.getResult(0).getType();
+            if (lhs.getType() != result_type || rhs.getType() != result_type) {
+                return;
+            }
+
+            auto lhs_cost = speculation_cost(lhs);
+            auto rhs_cost = speculation_cost(rhs);
+            if (!lhs_cost || !rhs_cost || !within_threshold(*lhs_cost + *rhs_cost)) {
+                return;
+            }
+
+            auto loc = op.getLoc();
+            mlir::OpBuilder bld(op);
+
+            auto lhs_val = inline_before(lhs, op);
+            auto rhs_val = inline_before(rhs, op);
+
+            auto select = bld.create< LLVM::SelectOp >(
+                loc, result_type, to_bool(bld, loc, cond), lhs_val, rhs_val
+            );
+            replace(op, select, { lhs, rhs });
+        }
+    };
+
+} // namespace vast::conv
+
+std::unique_ptr< mlir::Pass > vast::createSpeculateLazyPass() {
+    return std::make_unique< vast::conv::SpeculateLazyPass >();
+}
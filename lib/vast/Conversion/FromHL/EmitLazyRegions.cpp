@@ -141,10 +141,23 @@ namespace vast
                 bin_lop_conversions
             >(config);
         }
+
+        std::vector< operation > conversion_roots() {
+            if (globals_only) {
+                return non_function_ops(getOperation());
+            }
+            return base::conversion_roots();
+        }
     };
 
     std::unique_ptr< mlir::Pass > createHLEmitLazyRegionsPass() {
         return std::make_unique< HLEmitLazyRegionsPass >();
     }
 
+    std::unique_ptr< mlir::Pass > createHLEmitGlobalLazyRegionsPass() {
+        auto pass = std::make_unique< HLEmitLazyRegionsPass >();
+        pass->globals_only = true;
+        return pass;
+    }
+
 } // namespace vast
@@ -0,0 +1,188 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <mlir/IR/Builders.h>
+#include <mlir/Interfaces/FunctionInterfaces.h>
+#include <llvm/ADT/SetVector.h>
+VAST_UNRELAX_WARNINGS
+
+#include "PassesDetails.hpp"
+
+#include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/LowLevel/LowLevelOps.hpp"
+
+#include "vast/Dialect/Core/CoreOps.hpp"
+#include "vast/Dialect/Core/CoreTraits.hpp"
+
+#include "vast/Util/Common.hpp"
+#include "vast/Util/Terminator.hpp"
+
+namespace vast::conv
+{
+    namespace
+    {
+        // Region that delimits the lexical scope of a local variable, or
+        // `nullptr` if the variable does not get lifetime markers. Variables
+        // of the function body live as long as the function itself, and
+        // variables directly in case bodies and statement expressions are
+        // left alone, as their scope is not delimited by the region.
+        mlir::Region *lexical_scope(ll::UninitializedVar var) {
+            if (var->getParentOfType< hl::StmtExprOp >()) {
+                return nullptr;
+            }
+
+            auto region = var->getParentRegion();
+            auto parent = region->getParentOp();
+
+            if (mlir::isa< core::ScopeOp, hl::IfOp >(parent)) {
+                return region;
+            }
+
+            // only bodies of loops, not their conditions or increments
+            if (auto loop = mlir::dyn_cast< hl::ForOp >(parent)) {
+                return &loop.getBodyRegion() == region ? region : nullptr;
+            }
+
+            if (auto loop = mlir::dyn_cast< hl::WhileOp >(parent)) {
+                return &loop.getBodyRegion() == region ? region : nullptr;
+            }
+
+            if (auto loop = mlir::dyn_cast< hl::DoOp >(parent)) {
+                return &loop.getBodyRegion() == region ? region : nullptr;
+            }
+
+            return nullptr;
+        }
+
+        bool contains(mlir::Region *scope, operation op) {
+            return op && scope->findAncestorOpInRegion(*op);
+        }
+
+        // Case labels jump into the middle of a scope, so a variable of a
+        // scope that holds a case label of an outer switch may be in use
+        // without ever passing its declaration.
+        bool bypassed_by_case(mlir::Region *scope) {
+            auto bypassed = [&] (operation op) {
+                return !contains(scope, op->getParentOfType< hl::SwitchOp >());
+            };
+
+            auto result = scope->walk([&] (operation op) {
+                if (mlir::isa< hl::CaseOp, hl::DefaultOp >(op) && bypassed(op)) {
+                    return mlir::WalkResult::interrupt();
+                }
+                return mlir::WalkResult::advance();
+            });
+
+            return result.wasInterrupted();
+        }
+
+        // Target of `break` or `continue` statement.
+        operation jump_target(operation jump) {
+            for (auto parent = jump->getParentOp(); parent; parent = parent->getParentOp()) {
+                if (mlir::isa< hl::ForOp, hl::WhileOp, hl::DoOp >(parent)) {
+                    return parent;
+                }
+
+                if (mlir::isa< hl::BreakOp >(jump) && mlir::isa< hl::SwitchOp >(parent)) {
+                    return parent;
+                }
+            }
+
+            return nullptr;
+        }
+
+        bool leaves_scope(operation op, mlir::Region *scope) {
+            if (core::is_return(op)) {
+                return true;
+            }
+
+            if (mlir::isa< hl::BreakOp, hl::ContinueOp >(op)) {
+                return !contains(scope, jump_target(op));
+            }
+
+            return false;
+        }
+
+    } // namespace
+
+    //
+    // Marks lifetimes of variables declared in nested scopes by
+    // `ll.lifetime.start` at the declaration and `ll.lifetime.end` at every
+    // exit of the scope, i.e., at its end and before returns, breaks and
+    // continues that leave it. Allocations are hoisted to the entry block
+    // when lowered to LLVM, hence markers are the only thing that tells LLVM
+    // that variables of disjoint scopes may share a stack slot.
+    //
+    // The pass runs while the control flow is still structured. Functions
+    // with labels are skipped, as gotos can bypass declarations.
+    //
+    struct EmitLifetimeMarkersPass : EmitLifetimeMarkersBase< EmitLifetimeMarkersPass >
+    {
+        void runOnOperation() override {
+            auto root = getOperation();
+
+            std::vector< ll::UninitializedVar > vars;
+            root->walk([&] (mlir::FunctionOpInterface fn) {
+                if (!has_labels(fn)) {
+                    fn->walk([&] (ll::UninitializedVar var) { vars.push_back(var); });
+                }
+            });
+
+            for (auto var : vars) {
+                emit(var);
+            }
+        }
+
+        static bool has_labels(mlir::FunctionOpInterface fn) {
+            return fn->walk([] (hl::LabelStmt) {
+                return mlir::WalkResult::interrupt();
+            }).wasInterrupted();
+        }
+
+        static void emit(ll::UninitializedVar var) {
+            auto scope = lexical_scope(var);
+            if (!scope || bypassed_by_case(scope)) {
+                return;
+            }
+
+            // `nullptr` stands for the end of the scope block
+            llvm::SmallSetVector< operation, 4 > exits;
+
+            auto &block = *var->getBlock();
+            if (any_terminator_t::has(block)) {
+                exits.insert(&block.back());
+            } else {
+                exits.insert(nullptr);
+            }
+
+            for (auto it = std::next(var->getIterator()); it != block.end(); ++it) {
+                it->walk([&] (operation op) {
+                    if (leaves_scope(op, scope)) {
+                        exits.insert(op);
+                    }
+                });
+            }
+
+            mlir::OpBuilder bld(var);
+            bld.setInsertionPointAfter(var);
+            bld.create< ll::LifetimeStart >(var.getLoc(), var);
+
+            for (auto exit : exits) {
+                if (exit) {
+                    bld.setInsertionPoint(exit);
+                } else {
+                    bld.setInsertionPointToEnd(&block);
+                }
+
+                bld.create< ll::LifetimeEnd >(var.getLoc(), var);
+            }
+        }
+    };
+
+} // namespace vast::conv
+
+std::unique_ptr< mlir::Pass > vast::createEmitLifetimeMarkersPass() {
+    return std::make_unique< vast::conv::EmitLifetimeMarkersPass >();
+}
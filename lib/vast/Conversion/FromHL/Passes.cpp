@@ -8,6 +8,7 @@ VAST_RELAX_WARNINGS
 VAST_UNRELAX_WARNINGS
 
 #include "vast/Conversion/Passes.hpp"
+#include "vast/Dialect/LowLevel/LowLevelOps.hpp"
 
 namespace vast::conv::pipeline {
 
@@ -15,9 +16,15 @@ namespace vast::conv::pipeline {
         return pass(createHLToHLBI);
     }
 
+    //
+    // Function local passes are nested on functions, so that the pass manager
+    // can run them in parallel. Passes that also need to process global
+    // variables are scheduled once more on the module in the `globals-only`
+    // mode.
+    //
     pipeline_step_ptr hl_to_ll_cf() {
         // TODO add dependencies
-        return pass(createHLToLLCFPass);
+        return nested< ll::FuncOp >(createHLToLLCFPass);
     }
 
     pipeline_step_ptr hl_to_ll_geps() {
@@ -27,12 +34,26 @@ namespace vast::conv::pipeline {
 
     pipeline_step_ptr hl_to_ll_vars() {
         // TODO add dependencies
-        return pass(createHLToLLVarsPass);
+        return nested< ll::FuncOp >(createHLToLLVarsPass);
+    }
+
+    pipeline_step_ptr emit_lifetime_markers() {
+        return nested< ll::FuncOp >(createEmitLifetimeMarkersPass);
+    }
+
+    // Named step, so that markers can be turned off by
+    // `-vast-disable-lifetime-markers`.
+    pipeline_step_ptr lifetime_markers() {
+        return compose("lifetime-markers", emit_lifetime_markers);
     }
 
     pipeline_step_ptr lazy_regions() {
         // TODO add dependencies
-        return pass(createHLEmitLazyRegionsPass);
+        return nested< ll::FuncOp >(createHLEmitLazyRegionsPass);
+    }
+
+    pipeline_step_ptr global_lazy_regions() {
+        return pass(createHLEmitGlobalLazyRegionsPass);
     }
 
     pipeline_step_ptr hl_to_ll_func() {
@@ -41,22 +62,32 @@ namespace vast::conv::pipeline {
     }
 
     pipeline_step_ptr fn_args_to_alloca() {
-        return pass(createFnArgsToAllocaPass);
+        return nested< ll::FuncOp >(createFnArgsToAllocaPass);
     }
 
     pipeline_step_ptr lower_value_categories() {
-        return pass(createLowerValueCategoriesPass);
+        return nested< ll::FuncOp >(createLowerValueCategoriesPass);
+    }
+
+    pipeline_step_ptr lower_global_value_categories() {
+        return pass(createLowerGlobalValueCategoriesPass);
     }
 
+    // Module passes are kept together at the beginning and at the end, so
+    // that adjacent function passes are merged into a single parallel sweep
+    // over the functions.
     pipeline_step_ptr to_ll() {
         return compose( "to-ll",
             hl_to_ll_func,
+            hl_to_ll_geps,
             hl_to_ll_vars,
+            lifetime_markers,
             hl_to_ll_cf,
-            hl_to_ll_geps,
             fn_args_to_alloca,
             lower_value_categories,
-            lazy_regions
+            lazy_regions,
+            lower_global_value_categories,
+            global_lazy_regions
         );
     }
 
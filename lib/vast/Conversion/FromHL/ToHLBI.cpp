@@ -311,10 +311,19 @@ namespace vast::conv {
                     op, op->getResultTypes(), operands
                 );
 
-            // case clang::Builtin::BI__builtin_expect:
-            // case clang::Builtin::BI__builtin_expect_with_probability:
-
-            // case clang::Builtin::BI__builtin_unpredictable:
+            // Branch prediction hints.
+            case clang::Builtin::BI__builtin_expect:
+                return visitor.template visit< hlbi::ExpectOp >(
+                    op, op->getResultTypes(), operands
+                );
+            case clang::Builtin::BI__builtin_expect_with_probability:
+                return visitor.template visit< hlbi::ExpectWithProbabilityOp >(
+                    op, op->getResultTypes(), operands
+                );
+            case clang::Builtin::BI__builtin_unpredictable:
+                return visitor.template visit< hlbi::UnpredictableOp >(
+                    op, op->getResultTypes(), operands
+                );
 
             // case clang::Builtin::BImove:
             // case clang::Builtin::BImove_if_noexcept:
@@ -6,6 +6,8 @@ VAST_RELAX_WARNINGS
 #include <mlir/Dialect/Func/IR/FuncOps.h>
 #include <mlir/Dialect/ControlFlow/IR/ControlFlowOps.h>
 
+#include <llvm/ADT/APSInt.h>
+
 #include <mlir/Transforms/DialectConversion.h>
 #include <mlir/Rewrite/FrozenRewritePatternSet.h>
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
@@ -24,13 +26,19 @@ VAST_UNRELAX_WARNINGS
 #include "vast/Conversion/Common/Rewriter.hpp"
 
 
+#include "vast/Dialect/Builtin/Ops.hpp"
 #include "vast/Dialect/Core/CoreTraits.hpp"
 #include "vast/Dialect/Core/CoreOps.hpp"
+#include "vast/Dialect/Core/CoreAttributes.hpp"
 #include "vast/Dialect/HighLevel/HighLevelDialect.hpp"
+#include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/LowLevel/LowLevelDialect.hpp"
 #include "vast/Dialect/LowLevel/LowLevelOps.hpp"
 
 #include "../PassesDetails.hpp"
 
+#include <limits>
+
 namespace vast::conv
 {
     namespace
@@ -81,6 +89,152 @@ namespace vast::conv
             });
         }
 
+        // Constant operand of a builtin, looking through casts.
+        std::optional< double > constant_value( mlir_value val )
+        {
+            auto def = val.getDefiningOp();
+            if ( auto cast = mlir::dyn_cast_or_null< hl::ImplicitCastOp >( def ) )
+                return constant_value( cast.getValue() );
+            if ( auto cast = mlir::dyn_cast_or_null< hl::CStyleCastOp >( def ) )
+                return constant_value( cast.getValue() );
+
+            auto cst = mlir::dyn_cast_or_null< hl::ConstantOp >( def );
+            if ( !cst )
+                return std::nullopt;
+
+            auto attr = cst.getValue();
+            if ( auto int_attr = mlir::dyn_cast< core::IntegerAttr >( attr ) )
+            {
+                auto value = int_attr.getValue();
+                if ( value.getSignificantBits() > 64 )
+                    return std::nullopt;
+                return value.isSigned() ? double( value.getSExtValue() )
+                                        : double( value.getZExtValue() );
+            }
+            if ( auto bool_attr = mlir::dyn_cast< core::BooleanAttr >( attr ) )
+                return bool_attr.getValue() ? 1.0 : 0.0;
+            if ( auto float_attr = mlir::dyn_cast< core::FloatAttr >( attr ) )
+            {
+                auto value = float_attr.getValue();
+                bool loses_info = false;
+                value.convert( llvm::APFloat::IEEEdouble(),
+                               llvm::APFloat::rmNearestTiesToEven, &loses_info );
+                return value.convertToDouble();
+            }
+            return std::nullopt;
+        }
+
+        // Integral casts that do not truncate keep whether the value is zero.
+        bool is_widening( hl::ImplicitCastOp cast )
+        {
+            auto from = mlir::dyn_cast< mlir::IntegerType >( cast.getValue().getType() );
+            auto to   = mlir::dyn_cast< mlir::IntegerType >( cast.getType() );
+            return from && to && from.getWidth() <= to.getWidth();
+        }
+
+        // Conversions of the condition to the type of the branch do not hide
+        // hints of the value being converted, as long as they preserve its
+        // truth. Truncating casts may turn the expected value to zero.
+        mlir_value strip_condition_casts( mlir_value val )
+        {
+            while ( auto cast = val.getDefiningOp< hl::ImplicitCastOp >() )
+            {
+                switch ( cast.getKind() )
+                {
+                    case hl::CastKind::IntegralCast:
+                        if ( !is_widening( cast ) )
+                            return val;
+                        val = cast.getValue();
+                        continue;
+                    case hl::CastKind::IntegralToBoolean:
+                    case hl::CastKind::NoOp:
+                        val = cast.getValue();
+                        continue;
+                    default:
+                        return val;
+                }
+            }
+            return val;
+        }
+
+        // Hints of a conditional branch, taken from `[[likely]]` and
+        // `[[unlikely]]` of the branching operation and from the builtins
+        // computing the condition. Weights are the ones of the LLVM
+        // `LowerExpectIntrinsic` pass.
+        struct branch_hints
+        {
+            using weights_t = std::pair< std::uint32_t, std::uint32_t >;
+
+            static constexpr std::uint32_t likely_weight   = 2000;
+            static constexpr std::uint32_t unlikely_weight = 1;
+
+            std::optional< weights_t > weights;
+            bool unpredictable = false;
+
+            branch_hints( mlir::Operation *op, mlir_value cond )
+            {
+                if ( op->hasAttr( hl::LikelyAttr::getMnemonic() ) )
+                    weights = { likely_weight, unlikely_weight };
+                else if ( op->hasAttr( hl::UnlikelyAttr::getMnemonic() ) )
+                    weights = { unlikely_weight, likely_weight };
+
+                auto val = strip_condition_casts( cond );
+                if ( auto hint = val.getDefiningOp< hlbi::UnpredictableOp >() )
+                {
+                    unpredictable = true;
+                    val = strip_condition_casts( hint.getValue() );
+                }
+
+                if ( auto expect = val.getDefiningOp< hlbi::ExpectOp >() )
+                {
+                    if ( auto expected = constant_value( expect.getExpected() ) )
+                        weights = oriented( { likely_weight, unlikely_weight }, *expected );
+                }
+                else if ( auto expect = val.getDefiningOp< hlbi::ExpectWithProbabilityOp >() )
+                {
+                    auto expected    = constant_value( expect.getExpected() );
+                    auto probability = constant_value( expect.getProbability() );
+                    if ( expected && probability && *probability >= 0.0 && *probability <= 1.0 )
+                        weights = oriented( with_probability( *probability ), *expected );
+                }
+            }
+
+            static weights_t with_probability( double probability )
+            {
+                constexpr double scale = std::numeric_limits< std::int32_t >::max() - 1;
+                return { std::uint32_t( probability * scale ) + 1,
+                         std::uint32_t( ( 1.0 - probability ) * scale ) + 1 };
+            }
+
+            // `weights` are of the expected value, which is the false branch
+            // if zero is expected.
+            static weights_t oriented( weights_t weights, double expected )
+            {
+                if ( expected == 0.0 )
+                    return { weights.second, weights.first };
+                return weights;
+            }
+
+            void attach( mlir::Operation *br ) const
+            {
+                auto ctx = br->getContext();
+                if ( weights )
+                {
+                    br->setAttr( ll::LowLevelDialect::getBranchWeightsAttrName(),
+                                 mlir::DenseI32ArrayAttr::get( ctx, {
+                                     std::int32_t( weights->first ),
+                                     std::int32_t( weights->second )
+                                 } ) );
+                }
+
+                if ( unpredictable )
+                {
+                    br->setAttr( ll::LowLevelDialect::getUnpredictableAttrName(),
+                                 mlir::UnitAttr::get( ctx ) );
+                }
+            }
+        };
+
         template< typename Fn, typename H, typename ... Args >
         auto apply( Fn &&fn, mlir::Operation *op )
         {
@@ -125,6 +279,12 @@ namespace vast::conv
             //        - `nullptr` means the next block after scope is used.
             mlir::Block *entry;
             mlir::Block *exit;
+            // `break` inside of a switch leaves the switch, not the enclosing
+            // loop, therefore it is left to be lowered together with the switch.
+            bool handle_breaks = true;
+            // Hints of the enclosing loop, attached to the back edges
+            // `continue` is lowered to.
+            mlir::Attribute loop_hints;
 
             handle_terminators( bld_t &bld, mlir::Block *entry, mlir::Block *exit )
                 : bld( bld ), entry( entry ), exit( exit )
@@ -155,6 +315,18 @@ namespace vast::conv
                 if ( starts_cf_scope( op ) )
                     return mlir::success();
 
+                if ( mlir::isa< hl::SwitchOp >( op ) && handle_breaks )
+                {
+                    auto nested = *this;
+                    nested.handle_breaks = false;
+                    return nested.run_regions( op );
+                }
+
+                return run_regions( op );
+            }
+
+            result_t run_regions( mlir::Operation *op )
+            {
                 for ( auto &region : op->getRegions() )
                     if ( mlir::failed( run( region ) ) )
                         return mlir::failure();
@@ -175,7 +347,11 @@ namespace vast::conv
                 bld.setInsertionPointAfter( op );
                 if ( entry )
                     return bld.template create< ll::Br >( op.getLoc(), entry );
-                return bld.template create< ll::ScopeRecurse >( op.getLoc() );
+
+                auto recurse = bld.template create< ll::ScopeRecurse >( op.getLoc() );
+                if ( loop_hints )
+                    recurse->setAttr( ll::LowLevelDialect::getLoopHintAttrName(), loop_hints );
+                return recurse;
             }
 
             maybe_op_t do_replace( hl::ReturnOp op )
@@ -187,6 +363,9 @@ namespace vast::conv
 
             maybe_op_t do_replace( hl::BreakOp op )
             {
+                if ( !handle_breaks )
+                    return {};
+
                 auto g = mlir::OpBuilder::InsertionGuard( bld );
                 bld.setInsertionPointAfter( op );
                 if ( exit )
@@ -232,6 +411,21 @@ namespace vast::conv
                 return mlir::success();
             }
 
+            // Hints of a loop are kept on its back edges, the latch branches LLVM
+            // reads the `llvm.loop` metadata from. Back edges of `continue` are
+            // annotated by `handle_terminators`.
+            static void attach_loop_hints( mlir::Operation *op,
+                                           mlir::Block &latch, mlir::Block &header )
+            {
+                auto hints = op->getAttr( hl::LoopHintAttr::getMnemonic() );
+                if ( !hints || empty( latch ) )
+                    return;
+
+                auto br = mlir::dyn_cast< ll::Br >( latch.back() );
+                if ( br && br.getDest() == &header )
+                    br->setAttr( ll::LowLevelDialect::getLoopHintAttrName(), hints );
+            }
+
             // Returns `[ cond_yield, coerced operand of cond_yield ]`
             static auto fetch_cond_yield( auto &&bld, mlir::Block &cond_block )
             {
@@ -274,9 +468,10 @@ namespace vast::conv
                 auto true_block = inline_region_before( rewriter,
                                                         op.getThenRegion(), tail_block );
 
-                bld.make_at_end< ll::CondBr >( cond_block,
-                                               op.getLoc(), cond_value,
-                                               true_block, false_block );
+                auto br = bld.make_at_end< ll::CondBr >( cond_block,
+                                                         op.getLoc(), cond_value,
+                                                         true_block, false_block );
+                branch_hints( op, cond_yield_op.getResult() ).attach( br );
                 rewriter.eraseOp( cond_yield_op );
 
 
@@ -334,9 +529,9 @@ namespace vast::conv
                 auto &cond_region = op.getCondRegion();
                 auto &body_region = op.getBodyRegion();
 
-                if ( mlir::failed( handle_terminators( rewriter,
-                                                       nullptr,
-                                                       nullptr ).run( op.getBodyRegion() ) ) )
+                auto terminators = handle_terminators( rewriter, nullptr, nullptr );
+                terminators.loop_hints = op->getAttr( hl::LoopHintAttr::getMnemonic() );
+                if ( mlir::failed( terminators.run( op.getBodyRegion() ) ) )
                 {
                     return mlir::failure();
                 }
@@ -351,8 +546,9 @@ namespace vast::conv
                 auto [ cond_yield, value ] = fetch_cond_yield( bld, *cond_block );
                 VAST_CHECK( value, "Condition region yield unexpected type" );
 
-                bld.make_at_end< ll::CondScopeRet >( cond_block,
-                                                     op.getLoc(), *value, body_block );
+                auto ret = bld.make_at_end< ll::CondScopeRet >( cond_block,
+                                                                op.getLoc(), *value, body_block );
+                branch_hints( op, cond_yield.getResult() ).attach( ret );
                 rewriter.eraseOp( cond_yield );
 
                 VAST_PATTERN_CHECK(parent_t::tie(bld, op.getLoc(),
@@ -362,6 +558,7 @@ namespace vast::conv
                 VAST_PATTERN_CHECK(parent_t::tie(bld, op.getLoc(),
                                                  *body_block, *cond_block),
                                    tie_fail);
+                parent_t::attach_loop_hints( op, *body_block, *cond_block );
 
                 rewriter.eraseOp( op );
                 return mlir::success();
@@ -409,8 +606,9 @@ namespace vast::conv
                 auto [ cond_yield, value ] = fetch_cond_yield( bld, *cond_block );
                 VAST_PATTERN_CHECK( value, "Condition region yield unexpected type" );
 
-                bld.make_at_end< ll::CondScopeRet >( cond_block,
-                                                     op.getLoc(), *value, body_block );
+                auto ret = bld.make_at_end< ll::CondScopeRet >( cond_block,
+                                                                op.getLoc(), *value, body_block );
+                branch_hints( op, cond_yield.getResult() ).attach( ret );
                 rewriter.eraseOp( cond_yield );
 
                 auto mk_tie = [ & ]( auto &from, auto &to )
@@ -421,6 +619,7 @@ namespace vast::conv
                 VAST_PATTERN_CHECK( mk_tie( *scope_entry, *cond_block ), tie_fail );
                 VAST_PATTERN_CHECK( mk_tie( *body_block, *inc_block ), tie_fail );
                 VAST_PATTERN_CHECK( mk_tie( *inc_block, *cond_block ), tie_fail );
+                parent_t::attach_loop_hints( op, *inc_block, *cond_block );
 
                 rewriter.eraseOp( op );
 
@@ -433,6 +632,292 @@ namespace vast::conv
             }
         };
 
+        // Evaluates case labels to integer constants. Labels folded by codegen
+        // carry their value, others are evaluated from the constants and casts
+        // of the label region. Enum constants are not resolved here, as that
+        // would need to look outside of the function being converted.
+        struct case_evaluator
+        {
+            using maybe_value_t = std::optional< llvm::APSInt >;
+
+            maybe_value_t value( hl::CaseOp op )
+            {
+                auto name = hl::HighLevelDialect::getCaseValueAttrName();
+                if ( auto folded = op->getAttrOfType< core::IntegerAttr >( name ) )
+                    return folded.getValue();
+
+                auto yield = terminator_t< hl::ValueYieldOp >::get( op.getLhs().front() );
+                if ( !yield )
+                    return std::nullopt;
+                return value( yield.op().getResult() );
+            }
+
+            // The last value of a GNU case range, ranges are folded by codegen.
+            maybe_value_t range_end( hl::CaseOp op )
+            {
+                auto name = hl::HighLevelDialect::getCaseRangeEndAttrName();
+                if ( auto folded = op->getAttrOfType< core::IntegerAttr >( name ) )
+                    return folded.getValue();
+                return std::nullopt;
+            }
+
+            maybe_value_t value( mlir_value val )
+            {
+                auto def = val.getDefiningOp();
+                if ( !def )
+                    return std::nullopt;
+
+                if ( auto cst = mlir::dyn_cast< hl::ConstantOp >( def ) )
+                    return value( cst.getValue() );
+                if ( auto cast = mlir::dyn_cast< hl::ImplicitCastOp >( def ) )
+                    return cast_value( cast );
+                if ( auto cast = mlir::dyn_cast< hl::CStyleCastOp >( def ) )
+                    return cast_value( cast );
+                return std::nullopt;
+            }
+
+            maybe_value_t value( mlir::Attribute attr )
+            {
+                if ( auto int_attr = mlir::dyn_cast< core::IntegerAttr >( attr ) )
+                    return int_attr.getValue();
+                if ( auto int_attr = mlir::dyn_cast< mlir::IntegerAttr >( attr ) )
+                    return llvm::APSInt( int_attr.getValue(),
+                                         int_attr.getType().isUnsignedInteger() );
+                if ( auto bool_attr = mlir::dyn_cast< core::BooleanAttr >( attr ) )
+                    return llvm::APSInt( llvm::APInt( 1, bool_attr.getValue() ), true );
+                return std::nullopt;
+            }
+
+            maybe_value_t cast_value( auto cast )
+            {
+                auto val = value( cast.getValue() );
+                if ( !val )
+                    return std::nullopt;
+
+                if ( auto int_type = mlir::dyn_cast< mlir::IntegerType >( cast.getType() ) )
+                {
+                    auto casted = val->extOrTrunc( int_type.getWidth() );
+                    casted.setIsUnsigned( int_type.isUnsigned() );
+                    return casted;
+                }
+
+                return val;
+            }
+        };
+
+        // Lowers `hl.switch` into a scope, whose entry block computes the
+        // condition and dispatches by `ll.switch` to the blocks of the case
+        // labels. Bodies of the labels are laid out in the source order, so
+        // a case without `break` falls through to the next one.
+        //
+        // Only labels that are immediate children of the cases region or of
+        // another label are supported; labels nested in other statements
+        // (e.g., Duff's device) make the pattern fail.
+        //
+        // GNU case ranges are expanded into their values, same as clang does
+        // for ranges of up to 64 values. Larger ranges are not supported.
+        struct switch_op : base_pattern< hl::SwitchOp >
+        {
+            using op_t = hl::SwitchOp;
+            using parent_t = base_pattern< op_t >;
+            using parent_t::parent_t;
+
+            static constexpr std::size_t max_case_range_size = 64;
+
+            static bool is_label( mlir::Operation *op )
+            {
+                return mlir::isa< hl::CaseOp, hl::DefaultOp >( op );
+            }
+
+            static mlir::Block &label_body( mlir::Operation *op )
+            {
+                if ( auto case_op = mlir::dyn_cast< hl::CaseOp >( op ) )
+                    return case_op.getBody().front();
+                return mlir::cast< hl::DefaultOp >( op ).getBody().front();
+            }
+
+            static void collect_labels( mlir::Block &block,
+                                        std::vector< mlir::Operation * > &labels )
+            {
+                for ( auto &op : block )
+                {
+                    if ( is_label( &op ) )
+                    {
+                        labels.push_back( &op );
+                        collect_labels( label_body( &op ), labels );
+                    }
+                }
+            }
+
+            static bool is_target_of( hl::SwitchOp op, mlir::Operation *nested )
+            {
+                auto parent = nested->getParentOp();
+                while ( !mlir::isa< hl::ForOp, hl::WhileOp, hl::DoOp, hl::SwitchOp >( parent ) )
+                    parent = parent->getParentOp();
+                return parent == op.getOperation();
+            }
+
+            mlir::LogicalResult matchAndRewrite(
+                op_t op,
+                typename op_t::Adaptor ops,
+                conversion_rewriter &rewriter) const override
+            {
+                auto bld = rewriter_wrapper_t( rewriter );
+
+                if ( op.getCases().size() != 1 || conv::size( op.getCases().front() ) != 1 )
+                    return mlir::failure();
+
+                auto &cases = op.getCases().front();
+
+                std::vector< mlir::Operation * > labels;
+                collect_labels( cases.front(), labels );
+
+                std::size_t own_labels = 0;
+                op->walk( [ & ]( mlir::Operation *nested ) {
+                    if ( is_label( nested ) && is_target_of( op, nested ) )
+                        ++own_labels;
+                } );
+
+                if ( own_labels != labels.size() )
+                    return mlir::failure();
+
+                auto cond_yield = terminator_t< hl::ValueYieldOp >::get(
+                    op.getCondRegion().front()
+                );
+                if ( !cond_yield )
+                    return mlir::failure();
+
+                auto cond = cond_yield.op().getResult();
+                auto cond_type = mlir::dyn_cast< mlir::IntegerType >( cond.getType() );
+                if ( !cond_type )
+                    return mlir::failure();
+
+                auto evaluator = case_evaluator{};
+
+                // Number of values of each case label, ranges have several
+                // and empty ranges none.
+                llvm::SmallVector< llvm::APInt > case_values;
+                llvm::SmallVector< std::size_t > case_sizes;
+                for ( auto label : labels )
+                {
+                    auto case_op = mlir::dyn_cast< hl::CaseOp >( label );
+                    if ( !case_op )
+                        continue;
+
+                    auto value = evaluator.value( case_op );
+                    if ( !value )
+                        return mlir::failure();
+
+                    auto last = evaluator.range_end( case_op ).value_or( *value );
+
+                    std::size_t size = 0;
+                    for ( auto it = *value; llvm::APSInt::compareValues( it, last ) <= 0; ++it )
+                    {
+                        if ( ++size > max_case_range_size )
+                        {
+                            case_op.emitError() << "case ranges of more than "
+                                                << max_case_range_size
+                                                << " values are not supported";
+                            return mlir::failure();
+                        }
+
+                        case_values.push_back( it.extOrTrunc( cond_type.getWidth() ) );
+
+                        // Do not wrap around at the maximal value of the type.
+                        if ( it == last )
+                            break;
+                    }
+
+                    case_sizes.push_back( size );
+                }
+
+                // Breaks of nested loops and switches are handled by their
+                // own lowering.
+                op->walk( [ & ]( hl::BreakOp brk ) {
+                    if ( !is_target_of( op, brk ) )
+                        return;
+                    make_after_op< ll::ScopeRet >( rewriter, brk, brk.getLoc() );
+                    rewriter.eraseOp( brk );
+                } );
+
+                auto scope = rewriter.create< ll::Scope >( op.getLoc() );
+                auto &body = scope.getBody();
+
+                auto cond_block = inline_region( rewriter, op.getCondRegion(), body );
+                inline_region( rewriter, cases, body );
+
+                mlir::Block *default_dest = nullptr;
+                llvm::SmallVector< mlir::Block * > case_dests;
+                auto case_size = case_sizes.begin();
+
+                for ( auto label : labels )
+                {
+                    // Consecutive labels (`case 1: case 2: ...`) share the block.
+                    auto block = label->getBlock();
+                    auto starts_block = llvm::all_of(
+                        llvm::make_range( block->begin(), label->getIterator() ),
+                        [] ( auto &prev ) { return is_label( &prev ); }
+                    );
+
+                    if ( !starts_block )
+                        block = rewriter.splitBlock( block, label->getIterator() );
+
+                    if ( mlir::isa< hl::CaseOp >( label ) )
+                        case_dests.append( *case_size++, block );
+                    else
+                        default_dest = block;
+
+                    // Nested labels and the fallthrough statements follow
+                    // the label in the same block.
+                    rewriter.inlineBlockBefore( &label_body( label ), block,
+                                                std::next( label->getIterator() ) );
+                    rewriter.eraseOp( label );
+                }
+
+                // Without default the switch is left if no case matches.
+                if ( !default_dest )
+                {
+                    default_dest = rewriter.createBlock( &body, body.end() );
+                    rewriter.create< ll::ScopeRet >( op.getLoc() );
+                }
+
+                for ( auto &block : llvm::drop_begin( body ) )
+                {
+                    if ( auto next = block.getNextNode() )
+                    {
+                        VAST_PATTERN_CHECK( parent_t::tie( bld, op.getLoc(), block, *next ),
+                                            tie_fail );
+                    }
+                    else if ( !any_terminator_t::has( block ) )
+                    {
+                        bld.make_at_end< ll::ScopeRet >( &block, op.getLoc() );
+                    }
+                }
+
+                auto values_type = mlir::RankedTensorType::get(
+                    { static_cast< std::int64_t >( case_values.size() ) },
+                    mlir::IntegerType::get( op.getContext(), cond_type.getWidth() )
+                );
+
+                auto values = mlir::DenseElementsAttr::get( values_type, case_values );
+
+                bld.make_at_end< ll::Switch >(
+                    cond_block, op.getLoc(), cond,
+                    mlir::cast< mlir::DenseIntElementsAttr >( values ),
+                    default_dest, case_dests
+                );
+                rewriter.eraseOp( cond_yield.op() );
+
+                rewriter.eraseOp( op );
+                return mlir::success();
+            }
+
+            static void legalize( conversion_target &trg )
+            {
+                trg.addIllegalOp< hl::SwitchOp >();
+            }
+        };
+
         template< typename op_t, typename trg_t >
         struct replace : base_pattern< op_t >
         {
@@ -461,6 +946,7 @@ namespace vast::conv
               if_op
             , while_op
             , for_op
+            , switch_op
             , replace< hl::ReturnOp, ll::ReturnOp >
             , replace< core::ImplicitReturnOp, ll::ReturnOp >
         >;
@@ -502,7 +988,7 @@ namespace vast::conv
                 // We really don't care if anything ws remove or not.
                 std::ignore = mlir::eraseUnreachableBlocks(rewriter, scope.getBody());
             };
-            this->getOperation().walk(clean_scopes);
+            this->getOperation()->walk(clean_scopes);
 
             auto clean_functions = [&](hl::FuncOp fn)
             {
@@ -510,7 +996,7 @@ namespace vast::conv
                 // We really don't care if anything ws remove or not.
                 std::ignore = mlir::eraseUnreachableBlocks(rewriter, fn.getBody());
             };
-            this->getOperation().walk(clean_functions);
+            this->getOperation()->walk(clean_functions);
         }
     };
 
@@ -24,19 +24,23 @@ namespace vast {
         {
             using op_t = hl::RecordMemberOp;
             using base = mlir::OpConversionPattern< op_t >;
-            using base::base;
+
+            const hl::type_definition_index &defs;
+
+            record_member_op(mcontext_t *mctx, const hl::type_definition_index &defs)
+                : base(mctx), defs(defs)
+            {}
 
             logical_result matchAndRewrite(
                 op_t op, typename op_t::Adaptor ops, conversion_rewriter &rewriter
             ) const override {
                 auto parent_type = ops.getRecord().getType();
 
-                auto mod = op->getParentOfType< vast_module >();
-                if (!mod) {
+                auto def = defs.definition_of(parent_type);
+                if (!def) {
                     return mlir::failure();
                 }
 
-                auto def = hl::definition_of(parent_type, mod);
                 if (auto struct_decl = mlir::dyn_cast_or_null< hl::StructDeclOp >(*def)) {
                     return lower(op, ops, rewriter, struct_decl);
                 }
@@ -91,9 +95,11 @@ namespace vast {
             trg.markUnknownOpDynamicallyLegal([](auto) { return true; });
             trg.addIllegalOp< hl::RecordMemberOp >();
 
+            const auto &defs = getAnalysis< hl::type_definition_index >();
+
             mlir::RewritePatternSet patterns(&mctx);
 
-            patterns.add< record_member_op >(&mctx);
+            patterns.add< record_member_op >(&mctx, defs);
 
             if (mlir::failed(mlir::applyPartialConversion(op, trg, std::move(patterns)))) {
                 return signalPassFailure();
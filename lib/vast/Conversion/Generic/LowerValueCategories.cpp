@@ -562,6 +562,15 @@ namespace vast::conv {
             // This will never have correct types but we want to have it legal.
             trg.addLegalOp< mlir::UnrealizedConversionCastOp >();
 
+            if (globals_only) {
+                // Functions are lowered by instances of the pass nested on them.
+                auto globals = non_function_ops(root);
+                if (mlir::failed(mlir::applyPartialConversion(globals, trg, std::move(patterns)))) {
+                    return signalPassFailure();
+                }
+                return;
+            }
+
             convert_function_types(tc);
             if (mlir::failed(mlir::applyPartialConversion(root, trg, std::move(patterns)))) {
                 return signalPassFailure();
@@ -584,3 +593,9 @@ namespace vast::conv {
 std::unique_ptr< mlir::Pass > vast::createLowerValueCategoriesPass() {
     return std::make_unique< vast::conv::LowerValueCategoriesPass >();
 }
+
+std::unique_ptr< mlir::Pass > vast::createLowerGlobalValueCategoriesPass() {
+    auto pass = std::make_unique< vast::conv::LowerValueCategoriesPass >();
+    pass->globals_only = true;
+    return pass;
+}
@@ -14,6 +14,39 @@ namespace vast::conv::irstollvm {
     // has (unfortunately) prefixed name with `LLVM` anyway.
     namespace LLVM = mlir::LLVM;
 
+    // Discardable attribute of `ll.load` and `ll.store` holding TBAA access
+    // tags, attached by `vast-emit-tbaa` and forwarded to LLVM memory operations.
+    static inline constexpr llvm::StringLiteral tbaa_attr_name = "tbaa";
+
+    static inline constexpr llvm::StringLiteral nounwind_attr_name  = "nounwind";
+    static inline constexpr llvm::StringLiteral norecurse_attr_name = "norecurse";
+
+    static inline bool has_passthrough(LLVM::LLVMFuncOp fn, llvm::StringRef name) {
+        if (auto attrs = fn.getPassthroughAttr()) {
+            return llvm::any_of(attrs, [&] (mlir::Attribute attr) {
+                auto str = mlir::dyn_cast< mlir::StringAttr >(attr);
+                return str && str.getValue() == name;
+            });
+        }
+        return false;
+    }
+
+    // Adds a function attribute passed through to LLVM by name, keeping the
+    // already present ones.
+    static inline void add_passthrough(LLVM::LLVMFuncOp fn, llvm::StringRef name) {
+        if (has_passthrough(fn, name)) {
+            return;
+        }
+
+        llvm::SmallVector< mlir::Attribute > attrs;
+        if (auto prev = fn.getPassthroughAttr()) {
+            attrs.append(prev.begin(), prev.end());
+        }
+
+        attrs.push_back(mlir::StringAttr::get(fn.getContext(), name));
+        fn.setPassthroughAttr(mlir::ArrayAttr::get(fn.getContext(), attrs));
+    }
+
     template< typename op_t >
     struct base_pattern : operation_to_llvm_conversion_pattern< op_t >
     {
@@ -27,13 +60,50 @@ namespace vast::conv::irstollvm {
 
         auto dl(auto op) const { return tc.getDataLayoutAnalysis()->getAtOrAbove(op); }
 
-        auto mk_alloca(auto &rewriter, mlir_type trg_type, auto loc) const {
+        static auto entry_block(operation op) -> mlir::Block * {
+            if (auto fn = op->getParentOfType< mlir::FunctionOpInterface >()) {
+                if (auto &body = fn.getFunctionBody(); !body.empty()) {
+                    return &body.front();
+                }
+            }
+            return nullptr;
+        }
+
+        auto abi_alignment(operation op, mlir_type ptr_type) const -> unsigned {
+            if (auto ptr = mlir::dyn_cast< LLVM::LLVMPointerType >(ptr_type)) {
+                if (auto element_type = ptr.getElementType()) {
+                    return dl(op).getTypeABIAlignment(element_type);
+                }
+            }
+            return 0;
+        }
+
+        // Allocations of a single element are static, hence they are hoisted
+        // to the entry block of the enclosing function, where LLVM treats
+        // them as fixed stack slots, instead of allocating on every
+        // execution of a nested scope or a loop. Hoisted allocations keep
+        // their relative order. The insertion point is found in the IR, so
+        // that it stays valid when the conversion rolls back or replaces
+        // operations.
+        auto mk_alloca(auto &rewriter, operation op, mlir_type trg_type) const {
+            auto loc = op->getLoc();
+
+            mlir::OpBuilder::InsertionGuard guard(rewriter);
+            if (auto entry = entry_block(op)) {
+                auto first_non_alloca = llvm::find_if(*entry, [] (auto &op) {
+                    return !mlir::isa< LLVM::AllocaOp, LLVM::ConstantOp >(op);
+                });
+                rewriter.setInsertionPoint(entry, first_non_alloca);
+            }
+
             auto count = rewriter.template create< LLVM::ConstantOp >(
                 loc, type_converter().convertType(rewriter.getIndexType()),
                 rewriter.getIntegerAttr(rewriter.getIndexType(), 1)
             );
 
-            return rewriter.template create< LLVM::AllocaOp >(loc, trg_type, count, 0);
+            return rewriter.template create< LLVM::AllocaOp >(
+                loc, trg_type, count, abi_alignment(op, trg_type)
+            );
         }
 
         // Some operations want more fine-grained control, and we really just
@@ -0,0 +1,263 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Conversion/Passes.hpp"
+
+VAST_RELAX_WARNINGS
+#include <mlir/Analysis/DataLayoutAnalysis.h>
+#include <mlir/Conversion/LLVMCommon/LoweringOptions.h>
+#include <mlir/Dialect/LLVMIR/LLVMDialect.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/TypeSwitch.h>
+#include <llvm/Support/MathExtras.h>
+VAST_UNRELAX_WARNINGS
+
+#include "../PassesDetails.hpp"
+
+#include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/HighLevel/HighLevelTypes.hpp"
+#include "vast/Dialect/HighLevel/TypeDefinitionIndex.hpp"
+#include "vast/Dialect/LowLevel/LowLevelOps.hpp"
+
+#include "vast/Conversion/TypeConverters/LLVMTypeConverter.hpp"
+
+#include "vast/Util/Common.hpp"
+
+#include "Common.hpp"
+
+namespace vast::conv::irstollvm
+{
+    //
+    // Builds the TBAA type tree from types of memory accesses before they are
+    // converted to LLVM types. The tree mirrors the one of clang:
+    //
+    //   root
+    //   `- omnipotent char (aliases everything)
+    //      |- scalar types (`int`, `double`, `any pointer`, ...)
+    //      `- structs with members at their offsets
+    //
+    // Signed and unsigned variants share the node, as C allows them to alias.
+    // Types of the same size are merged as well (e.g. `long` and `long long`),
+    // which only makes the tree more conservative.
+    //
+    struct tbaa_builder
+    {
+        using type_desc = LLVM::TBAATypeDescriptorAttr;
+
+        tbaa_builder(
+            mcontext_t &mctx, tc::FullLLVMTypeConverter &tc,
+            const mlir::DataLayout &dl, const hl::type_definition_index &defs
+        )
+            : mctx(mctx), tc(tc), dl(dl), defs(defs)
+            , root(LLVM::TBAARootAttr::get(&mctx, mlir::StringAttr::get(&mctx, "VAST TBAA")))
+            , char_desc(type_desc::get(&mctx, "omnipotent char", { member(root, 0) }))
+        {}
+
+        // Access tag of a scalar load or store of `type` through `ptr`, or
+        // null attribute if the access is not described by the tree.
+        LLVM::TBAATagAttr access_tag(mlir_type type, mlir_value ptr) {
+            auto access = scalar(type);
+            if (!access) {
+                return {};
+            }
+
+            // Struct-path: walk member accesses from the accessed field
+            // outwards, up to the outermost struct.
+            type_desc base;
+            std::int64_t offset = 0;
+            for (auto gep = ptr.getDefiningOp< ll::StructGEPOp >(); gep;
+                 gep = gep.getRecord().getDefiningOp< ll::StructGEPOp >()
+            ) {
+                auto def = definition(gep.getRecord().getType());
+                if (!def) {
+                    break;
+                }
+
+                // Members of unions may alias anything, including the accesses
+                // through the enclosing structs.
+                if (mlir::isa< hl::UnionDeclOp >(def.getOperation())) {
+                    return LLVM::TBAATagAttr::get(char_desc, char_desc, 0);
+                }
+
+                auto info = record(def);
+                if (!info || gep.getIdx() >= info->offsets.size()) {
+                    break;
+                }
+
+                offset += info->offsets[gep.getIdx()];
+                base = info->desc;
+            }
+
+            if (!base) {
+                return LLVM::TBAATagAttr::get(access, access, 0);
+            }
+
+            return LLVM::TBAATagAttr::get(base, access, offset);
+        }
+
+      private:
+        struct record_info
+        {
+            type_desc desc;
+            std::vector< std::int64_t > offsets;
+        };
+
+        LLVM::TBAAMemberAttr member(LLVM::TBAANodeAttr desc, std::int64_t offset) {
+            return LLVM::TBAAMemberAttr::get(&mctx, desc, offset);
+        }
+
+        type_desc scalar_desc(llvm::StringRef name) {
+            return type_desc::get(&mctx, name, { member(char_desc, 0) });
+        }
+
+        type_desc scalar(mlir_type type) {
+            return llvm::TypeSwitch< mlir_type, type_desc >(type)
+                .Case([&] (mlir::IntegerType ty) -> type_desc {
+                    switch (ty.getWidth()) {
+                        case 1: case 8: return char_desc;
+                        case 16:  return scalar_desc("short");
+                        case 32:  return scalar_desc("int");
+                        case 64:  return scalar_desc("long");
+                        case 128: return scalar_desc("__int128");
+                        default:  return {};
+                    }
+                })
+                .Case([&] (mlir::FloatType ty) -> type_desc {
+                    switch (ty.getWidth()) {
+                        case 16:  return scalar_desc("_Float16");
+                        case 32:  return scalar_desc("float");
+                        case 64:  return scalar_desc("double");
+                        case 80:  return scalar_desc("long double");
+                        case 128: return scalar_desc("__float128");
+                        default:  return {};
+                    }
+                })
+                .Case([&] (hl::PointerType) { return scalar_desc("any pointer"); })
+                .Default([] (auto) { return type_desc(); });
+        }
+
+        // Type of a struct member, anything that is neither a scalar nor
+        // a struct is described conservatively as `char`.
+        type_desc member_type(mlir_type type) {
+            if (auto desc = scalar(type)) {
+                return desc;
+            }
+
+            auto def = definition(type);
+            if (def && !mlir::isa< hl::UnionDeclOp >(def.getOperation())) {
+                if (auto info = record(def)) {
+                    return info->desc;
+                }
+            }
+
+            return char_desc;
+        }
+
+        AggregateTypeDefinitionInterface definition(mlir_type type) {
+            if (auto ptr = mlir::dyn_cast< hl::PointerType >(type)) {
+                type = ptr.getElementType();
+            }
+            return defs.definition_of(type);
+        }
+
+        // The returned pointer is valid only until the next record is laid out.
+        const record_info *record(AggregateTypeDefinitionInterface def) {
+            auto it = records.find(def.getOperation());
+            if (it == records.end()) {
+                // Layout of nested records inserts into the cache as well.
+                auto info = layout(def);
+                it = records.try_emplace(def.getOperation(), std::move(info)).first;
+            }
+            return it->second ? &*it->second : nullptr;
+        }
+
+        // Member offsets are taken from the LLVM struct the record converts to,
+        // so that they match the emitted geps.
+        std::optional< record_info > layout(AggregateTypeDefinitionInterface def) {
+            auto converted = tc.convert_type_to_type(def.getDefinedType());
+            if (!converted) {
+                return std::nullopt;
+            }
+
+            auto st = mlir::dyn_cast< LLVM::LLVMStructType >(*converted);
+            if (!st || st.isOpaque()) {
+                return std::nullopt;
+            }
+
+            std::vector< mlir_type > fields;
+            for (auto field : def.getFieldTypes()) {
+                fields.push_back(field);
+            }
+
+            auto body = st.getBody();
+            if (fields.size() != body.size()) {
+                return std::nullopt;
+            }
+
+            record_info info;
+            llvm::SmallVector< LLVM::TBAAMemberAttr > members;
+
+            std::int64_t offset = 0;
+            for (auto [field, llvm_field] : llvm::zip(fields, body)) {
+                if (!st.isPacked()) {
+                    offset = std::int64_t(llvm::alignTo(offset, dl.getTypeABIAlignment(llvm_field)));
+                }
+                info.offsets.push_back(offset);
+                members.push_back(member(member_type(field), offset));
+                offset += std::int64_t(dl.getTypeSize(llvm_field));
+            }
+
+            info.desc = type_desc::get(&mctx, def.getDefinedName(), members);
+            return info;
+        }
+
+        mcontext_t &mctx;
+        tc::FullLLVMTypeConverter &tc;
+        const mlir::DataLayout &dl;
+        const hl::type_definition_index &defs;
+
+        LLVM::TBAARootAttr root;
+        type_desc char_desc;
+
+        llvm::DenseMap< operation, std::optional< record_info > > records;
+    };
+
+    struct EmitTBAAPass : EmitTBAABase< EmitTBAAPass >
+    {
+        void runOnOperation() override {
+            auto mod   = this->getOperation();
+            auto &mctx = this->getContext();
+
+            const auto &dl_analysis = this->getAnalysis< mlir::DataLayoutAnalysis >();
+            const auto &defs = this->getAnalysis< hl::type_definition_index >();
+
+            // Same options as in `IRsToLLVM`, so that records are laid out the
+            // same way.
+            mlir::LowerToLLVMOptions llvm_options{ &mctx };
+            llvm_options.useBarePtrCallConv = true;
+            auto tc = tc::FullLLVMTypeConverter(defs, &mctx, llvm_options, &dl_analysis);
+
+            tbaa_builder tbaa(mctx, tc, dl_analysis.getAtOrAbove(mod), defs);
+
+            auto attach = [&] (operation op, mlir_type type, mlir_value ptr) {
+                if (auto tag = tbaa.access_tag(type, ptr)) {
+                    op->setAttr(tbaa_attr_name, mlir::ArrayAttr::get(&mctx, { tag }));
+                }
+            };
+
+            mod.walk([&] (operation op) {
+                llvm::TypeSwitch< operation >(op)
+                    .Case([&] (ll::Load load) {
+                        attach(load, load.getResult().getType(), load.getPtr());
+                    })
+                    .Case([&] (ll::Store store) {
+                        attach(store, store.getVal().getType(), store.getPtr());
+                    });
+            });
+        }
+    };
+} // namespace vast::conv::irstollvm
+
+std::unique_ptr< mlir::Pass > vast::createEmitTBAAPass() {
+    return std::make_unique< vast::conv::irstollvm::EmitTBAAPass >();
+}
@@ -13,6 +13,8 @@ VAST_RELAX_WARNINGS
 
 #include <llvm/ADT/APFloat.h>
 #include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/xxhash.h>
 VAST_UNRELAX_WARNINGS
 
 #include "../PassesDetails.hpp"
@@ -25,9 +27,12 @@ VAST_UNRELAX_WARNINGS
 
 #include "vast/Dialect/LowLevel/LowLevelOps.hpp"
 
+#include "vast/Dialect/Builtin/Ops.hpp"
+
 #include "vast/Dialect/Core/CoreOps.hpp"
 #include "vast/Dialect/Core/TypeTraits.hpp"
 
+#include "vast/Util/Attribute.hpp"
 #include "vast/Util/Common.hpp"
 #include "vast/Util/Symbols.hpp"
 #include "vast/Util/Terminator.hpp"
@@ -59,6 +64,144 @@ namespace vast::conv::irstollvm
 
       protected:
 
+        // Folds an initializer built only from constants into an attribute of
+        // the converted `type`, so that it does not have to be rebuilt one
+        // element at a time. Returns null attribute otherwise.
+        mlir::Attribute constant_initializer(operation op, mlir_type type) const {
+            if (auto arr = mlir::dyn_cast< mlir::LLVM::LLVMArrayType >(type))
+                return dense_initializer(op, arr);
+            return scalar_constant(op, type);
+        }
+
+        static mlir::Attribute scalar_constant(operation op, mlir_type type) {
+            if (auto cast = mlir::dyn_cast_or_null< hl::ImplicitCastOp >(op)) {
+                if (cast.getKind() != hl::CastKind::IntegralCast)
+                    return {};
+                return scalar_constant(cast.getValue().getDefiningOp(), type);
+            }
+
+            auto cst = mlir::dyn_cast_or_null< hl::ConstantOp >(op);
+            if (!cst)
+                return {};
+
+            auto value = cst.getValue();
+            if (auto int_type = mlir::dyn_cast< mlir::IntegerType >(type)) {
+                if (auto attr = mlir::dyn_cast< core::IntegerAttr >(value)) {
+                    auto bits = attr.getValue().extOrTrunc(int_type.getWidth());
+                    return mlir::IntegerAttr::get(int_type, bits);
+                }
+                if (auto attr = mlir::dyn_cast< core::BooleanAttr >(value))
+                    return mlir::IntegerAttr::get(int_type, attr.getValue());
+            }
+
+            if (auto float_type = mlir::dyn_cast< mlir::FloatType >(type)) {
+                if (auto attr = mlir::dyn_cast< core::FloatAttr >(value)) {
+                    const auto &sema = attr.getValue().getSemantics();
+                    if (&sema == &float_type.getFloatSemantics())
+                        return mlir::FloatAttr::get(float_type, attr.getValue());
+                }
+            }
+
+            return {};
+        }
+
+        static auto array_shape(mlir::LLVM::LLVMArrayType type) {
+            llvm::SmallVector< std::int64_t > shape;
+            mlir_type elem = type;
+            while (auto arr = mlir::dyn_cast< mlir::LLVM::LLVMArrayType >(elem)) {
+                shape.push_back(arr.getNumElements());
+                elem = arr.getElementType();
+            }
+            return std::make_tuple(shape, elem);
+        }
+
+        static mlir::DenseElementsAttr dense_value(hl::InitListExpr init_list, mlir::ShapedType type) {
+            auto dense = mlir::dyn_cast_or_null< mlir::DenseElementsAttr >(init_list.getValueAttr());
+            if (!dense)
+                return {};
+            if (dense.getElementType() != type.getElementType())
+                return {};
+            if (dense.getNumElements() != type.getNumElements())
+                return {};
+            return dense.reshape(type);
+        }
+
+        // Appends constant elements of `init_list` in row-major order. Elements
+        // missing in the list are zero.
+        static bool collect_constants(
+            hl::InitListExpr init_list, mlir::LLVM::LLVMArrayType type,
+            llvm::SmallVectorImpl< mlir::Attribute > &out
+        ) {
+            auto scalar   = std::get< 1 >(array_shape(type));
+            auto elem     = type.getElementType();
+            auto elements = init_list.getElements();
+
+            if (elements.size() > type.getNumElements())
+                return false;
+
+            auto nested_type = mlir::dyn_cast< mlir::LLVM::LLVMArrayType >(elem);
+            auto stride = nested_type
+                ? mlir::RankedTensorType::get(std::get< 0 >(array_shape(nested_type)), scalar)
+                    .getNumElements()
+                : 1;
+
+            for (auto element : elements) {
+                auto def = element.getDefiningOp();
+                if (!nested_type) {
+                    auto attr = scalar_constant(def, elem);
+                    if (!attr)
+                        return false;
+                    out.push_back(attr);
+                    continue;
+                }
+
+                auto nested = mlir::dyn_cast_or_null< hl::InitListExpr >(def);
+                if (!nested)
+                    return false;
+
+                if (nested.getValueAttr()) {
+                    auto shape_type = mlir::RankedTensorType::get(
+                        std::get< 0 >(array_shape(nested_type)), scalar
+                    );
+                    auto dense = dense_value(nested, shape_type);
+                    if (!dense)
+                        return false;
+                    llvm::append_range(out, dense.getValues< mlir::Attribute >());
+                } else if (!collect_constants(nested, nested_type, out)) {
+                    return false;
+                }
+            }
+
+            auto missing = (type.getNumElements() - elements.size()) * stride;
+            out.append(missing, mlir::Builder(type.getContext()).getZeroAttr(scalar));
+            return true;
+        }
+
+        static mlir::Attribute dense_initializer(operation op, mlir::LLVM::LLVMArrayType type) {
+            auto init_list = mlir::dyn_cast_or_null< hl::InitListExpr >(op);
+            if (!init_list)
+                return {};
+
+            auto [shape, scalar] = array_shape(type);
+            if (!mlir::isa< mlir::IntegerType, mlir::FloatType >(scalar))
+                return {};
+
+            auto dense_type = mlir::RankedTensorType::get(shape, scalar);
+
+            // Dense initializers from codegen are used as they are.
+            if (init_list.getValueAttr())
+                return dense_value(init_list, dense_type);
+
+            llvm::SmallVector< mlir::Attribute > elements;
+            if (!collect_constants(init_list, type, elements))
+                return {};
+            return mlir::DenseElementsAttr::get(dense_type, elements);
+        }
+
+        mlir_value constant(auto &rewriter, auto loc, mlir::Attribute value, mlir_type type) const {
+            return rewriter.template create< mlir::LLVM::ConstantOp >(loc, type, value);
+        }
+
         mlir_value construct_value(auto &rewriter, mlir_value val) const {
             auto op = val.getDefiningOp();
             VAST_ASSERT(op && op->getResults().size() == 1);
@@ -73,9 +216,26 @@ namespace vast::conv::irstollvm
                 VAST_CHECK(op->getResults().size() == 1, "Unexpected number of results");
                 return op->getResults()[0];
             }
+
+            auto trg_type = self().convert(type);
+            if (auto value = constant_initializer(init_list, trg_type))
+                return constant(rewriter, init_list.getLoc(), value, trg_type);
+
+            if (init_list.getValueAttr())
+                return dense_mismatch(init_list, trg_type);
+
             return construct_value(rewriter, init_list.getLoc(), init_list.getElements(), type);
         }
 
+        // Dense initializers from codegen have no element operands, hence
+        // there is nothing to build the value from if the attribute does not
+        // fit the lowered type.
+        static mlir_value dense_mismatch(hl::InitListExpr init_list, mlir_type type) {
+            init_list.emitError() << "dense initializer does not match the lowered type "
+                                  << type;
+            return {};
+        }
+
         mlir_value construct_value(auto &rewriter, auto loc,
                                    const auto &operands, mlir_type type) const
         {
@@ -95,6 +255,8 @@ namespace vast::conv::irstollvm
             for (auto [idx, element] : llvm::enumerate(operands))
             {
                 auto elem = construct_value(rewriter, element);
+                if (!elem)
+                    return {};
                 init = rewriter.template create< mlir::LLVM::InsertValueOp >(
                     loc, init, elem, idx);
             }
@@ -323,7 +485,7 @@ namespace vast::conv::irstollvm
                 op_t op, typename op_t::Adaptor ops,
                 conversion_rewriter &rewriter) const override
         {
-            auto alloca = mk_alloca(rewriter, convert(op.getType()), op.getLoc());
+            auto alloca = mk_alloca(rewriter, op, convert(op.getType()));
             rewriter.replaceOp(op, alloca);
 
             return logical_result::success();
@@ -342,6 +504,9 @@ namespace vast::conv::irstollvm
                 conversion_rewriter &rewriter) const override
         {
             auto element = this->construct_value(rewriter, ops.getElements()[0]);
+            if (!element)
+                return mlir::failure();
+
             auto ptr = ops.getVar();
 
             rewriter.template create< LLVM::StoreOp >(
@@ -366,19 +531,47 @@ namespace vast::conv::irstollvm
                 conversion_rewriter &rewriter) const override
         {
             VAST_PATTERN_CHECK(op.getNumResults() == 1, "Unexpected number of results");
+
+            auto trg_type = convert(op.getType(0));
+            if (auto value = constant_initializer(op, trg_type)) {
+                rewriter.replaceOp(op, constant(rewriter, op.getLoc(), value, trg_type));
+                return mlir::success();
+            }
+
+            if (op.getValueAttr()) {
+                dense_mismatch(op, trg_type);
+                return mlir::failure();
+            }
+
             auto value = construct_value(
                 rewriter, op.getLoc(), ops.getOperands(), op.getType(0));
+            if (!value)
+                return mlir::failure();
             rewriter.replaceOp(op, value);
             return mlir::success();
         }
     };
 
-    struct vardecl : base_pattern< hl::VarDeclOp >
+    struct vardecl : base_pattern< hl::VarDeclOp >,
+                     value_builder< vardecl >
     {
         using op_t = hl::VarDeclOp;
         using base = base_pattern< op_t >;
         using base::base;
 
+        mlir::Attribute constant_initializer(op_t op, mlir_type type) const {
+            auto &init = op.getInitializer();
+            if (init.empty())
+                return {};
+
+            auto yield = terminator_t< hl::ValueYieldOp >::get(init.front());
+            if (!yield)
+                return {};
+
+            auto value = yield.op().getResult().getDefiningOp();
+            return value_builder< vardecl >::constant_initializer(value, type);
+        }
+
         logical_result matchAndRewrite(
                 op_t op, typename op_t::Adaptor ops,
                 conversion_rewriter &rewriter) const override
@@ -406,12 +599,17 @@ namespace vast::conv::irstollvm
                     LLVM::Linkage::Internal,
                     op.getName(), create_dummy_value());
 
+            // Constant initializers are emitted directly as the value
+            // attribute, which avoids materializing them op by op.
+            if (auto value = constant_initializer(op, target_type)) {
+                gop.setValueAttr(value);
+                rewriter.eraseOp(op);
+                return logical_result::success();
+            }
+
             // If we want the global to have a body it cannot have value attribute.
             gop.removeValueAttr();
 
-            // We could probably try to analyze the region to see if it isn't
-            // a case where we can just do an attribute, but for now let's
-            // just use the initializer.
             auto &region = gop.getInitializerRegion();
             rewriter.inlineRegionBefore(op.getInitializer(),
                                         region, region.begin());
@@ -480,11 +678,6 @@ namespace vast::conv::irstollvm
             auto target_type = *maybe_target_type;
             auto signature = *maybe_signature;
 
-            // TODO(irs-to-llvm): Currently it is unclear what to do with the
-            //                    arg/res attributes as it looks like we may not
-            //                    want to lower them all.
-
-
             // TODO(lukas): Linkage?
             auto linkage = LLVM::Linkage::External;
             auto new_func = rewriter.create< LLVM::LLVMFuncOp >(
@@ -492,6 +685,7 @@ namespace vast::conv::irstollvm
                 target_type, linkage,
                 func_op.isVarArg(), LLVM::CConv::C
             );
+            lower_attrs(func_op, new_func);
             rewriter.inlineRegionBefore(func_op.getBody(), new_func.getBody(), new_func.end());
             tc::convert_region_types(func_op, new_func, signature);
 
@@ -502,6 +696,105 @@ namespace vast::conv::irstollvm
             return logical_result::success();
         }
 
+        // Source attributes are lowered only where they give facts LLVM can
+        // rely on, other arg/res attributes are dropped.
+        void lower_attrs(op_t func_op, LLVM::LLVMFuncOp fn) const {
+            auto mctx = fn.getContext();
+            auto unit = mlir::UnitAttr::get(mctx);
+
+            auto memory = [&] (LLVM::ModRefInfo info) {
+                return LLVM::MemoryEffectsAttr::get(mctx, info, info, info);
+            };
+
+            if (util::has_attr_of_type< hl::ConstAttr >(func_op)) {
+                fn.setMemoryAttr(memory(LLVM::ModRefInfo::NoModRef));
+            } else if (util::has_attr_of_type< hl::PureAttr >(func_op)) {
+                fn.setMemoryAttr(memory(LLVM::ModRefInfo::Ref));
+            }
+
+            auto fty = fn.getFunctionType();
+            if (mlir::isa< LLVM::LLVMPointerType >(fty.getReturnType())) {
+                // `hl::RestrictAttr` on a function comes from `malloc`.
+                if (util::has_attr_of_type< hl::RestrictAttr >(func_op)) {
+                    fn.setResultAttr(0, LLVM::LLVMDialect::getNoAliasAttrName(), unit);
+                }
+
+                if (util::has_attr_of_type< hl::ReturnsNonNullAttr >(func_op)) {
+                    fn.setResultAttr(0, LLVM::LLVMDialect::getNonNullAttrName(), unit);
+                }
+            }
+
+            lower_fn_attrs(func_op, fn);
+
+            // Facts were remapped to the arguments by the ABI lowering, a
+            // signature of another origin may not match them.
+            auto params = fty.getParams();
+            if (func_op.getNumArguments() != params.size()) {
+                return;
+            }
+
+            for (auto [idx, param] : llvm::enumerate(params)) {
+                auto facts = func_op.getArgAttrDict(unsigned(idx));
+                if (!facts || !mlir::isa< LLVM::LLVMPointerType >(param)) {
+                    continue;
+                }
+
+                auto set = [&] (llvm::StringRef name, mlir::Attribute value) {
+                    fn.setArgAttr(unsigned(idx), name, value);
+                };
+
+                // Objects accessed through a `const T *restrict` pointer are
+                // not modified by any means while the function executes.
+                if (facts.get(hl::RestrictAttr::getMnemonic())) {
+                    set(LLVM::LLVMDialect::getNoAliasAttrName(), unit);
+                    if (facts.get(hl::ConstAttr::getMnemonic())) {
+                        set(LLVM::LLVMDialect::getReadonlyAttrName(), unit);
+                    }
+                }
+
+                if (facts.get(hl::NonNullAttr::getMnemonic())) {
+                    set(LLVM::LLVMDialect::getNonNullAttrName(), unit);
+                }
+
+                auto deref_name = hl::DereferenceableAttr::getMnemonic();
+                if (auto deref = facts.getAs< hl::DereferenceableAttr >(deref_name)) {
+                    auto i64 = mlir::IntegerType::get(mctx, 64);
+                    set(
+                        LLVM::LLVMDialect::getDereferenceableAttrName(),
+                        mlir::IntegerAttr::get(i64, deref.getBytes())
+                    );
+                }
+            }
+        }
+
+        // Function attributes without a dedicated field in `llvm.func` are
+        // passed through to LLVM by name.
+        void lower_fn_attrs(op_t func_op, LLVM::LLVMFuncOp fn) const {
+            using util::has_attr_of_type;
+
+            // As in clang, `noinline` wins over any request to inline and
+            // a function cannot be both cold and hot.
+            bool noinline     = has_attr_of_type< hl::NoInlineAttr >(func_op);
+            bool alwaysinline = !noinline && has_attr_of_type< hl::AlwaysInlineAttr >(func_op);
+            bool inlinehint   = !noinline && !alwaysinline && has_attr_of_type< hl::InlineHintAttr >(func_op);
+            bool cold         = has_attr_of_type< hl::ColdAttr >(func_op);
+            bool hot          = !cold && has_attr_of_type< hl::HotAttr >(func_op);
+
+            auto add_if = [&] (bool cond, llvm::StringRef name) {
+                if (cond) {
+                    add_passthrough(fn, name);
+                }
+            };
+
+            add_if(has_attr_of_type< hl::NoThrowAttr >(func_op), nounwind_attr_name);
+            add_if(has_attr_of_type< hl::NoRecurseAttr >(func_op), norecurse_attr_name);
+            add_if(noinline, "noinline");
+            add_if(alwaysinline, "alwaysinline");
+            add_if(inlinehint, "inlinehint");
+            add_if(cold, "cold");
+            add_if(hot, "hot");
+        }
+
         logical_result args_to_allocas(
                 mlir::LLVM::LLVMFuncOp fn,
                 conversion_rewriter &rewriter) const
@@ -549,25 +842,14 @@ namespace vast::conv::irstollvm
 
         static inline constexpr const char *strlit_global_var_prefix = "vast.strlit.constant_";
 
-        std::string next_strlit_name(vast_module mod) const
-        {
-            std::size_t current = 0;
-            for (auto &op : mod.getOps())
-            {
-                auto global = mlir::dyn_cast< mlir::LLVM::GlobalOp >(op);
-                if (!global)
-                    continue;
-
-                auto name = global.getName();
-                if (!name.consume_front(strlit_global_var_prefix))
-                    continue;
-
-                std::size_t idx = 0;
-                name.getAsInteger(10, idx);
-                current = std::max< std::size_t >(idx, current);
-            }
-            return strlit_global_var_prefix + std::to_string(current + 1);
-
+        // Identical string literals share one global. Its name is derived from
+        // the bytes of the literal, so the symbol table of the module tells
+        // whether it was emitted already.
+        static std::string strlit_name(llvm::StringRef bytes, std::size_t collision) {
+            auto name = strlit_global_var_prefix + llvm::utohexstr(llvm::xxHash64(bytes));
+            if (collision == 0)
+                return name;
+            return name + "." + std::to_string(collision);
         }
 
         logical_result handle_void_const(
@@ -640,35 +922,43 @@ namespace vast::conv::irstollvm
         }
 
 
+        // `bytes` of the literal include the terminating zero.
         mlir::Value convert_strlit(hl::ConstantOp op, auto rewriter, auto &tc,
-                                   mlir_type target_type, mlir::StringAttr str_lit) const
+                                   mlir_type target_type, llvm::StringRef bytes) const
         {
-            // We need to include the terminating `0` which will not happen
-            // if we "just" pass the value in.
-            auto twine = llvm::Twine(std::string_view(str_lit.getValue().data(),
-                                                      str_lit.getValue().size() + 1));
-            auto converted_attr = mlir::StringAttr::get(op->getContext(), twine);
-
             auto ptr_type = mlir::dyn_cast< mlir::LLVM::LLVMPointerType >(target_type);
+            auto global_type = ptr_type.getElementType();
+            auto value = mlir::StringAttr::get(op->getContext(), bytes);
 
             auto mod = op->getParentOfType< mlir::ModuleOp >();
-            auto name = next_strlit_name(mod);
+
+            auto address_of = [&] (const std::string &name) -> mlir::Value {
+                return rewriter->template create< mlir::LLVM::AddressOfOp >(op.getLoc(),
+                                                                            target_type,
+                                                                            name);
+            };
+
+            auto name = strlit_name(bytes, 0);
+            for (std::size_t collision = 1; auto sym = mod.lookupSymbol(name); ++collision) {
+                auto global = mlir::dyn_cast< mlir::LLVM::GlobalOp >(sym);
+                if (global && global.getValueAttr() == value && global.getType() == global_type)
+                    return address_of(name);
+                name = strlit_name(bytes, collision);
+            }
 
             rewriter.guarded([&]()
             {
                 rewriter->setInsertionPoint(&*mod.begin());
                 rewriter->template create< mlir::LLVM::GlobalOp >(
                     op.getLoc(),
-                    ptr_type.getElementType(),
+                    global_type,
                     true, /* is constant */
                     LLVM::Linkage::Internal,
                     name,
-                    converted_attr);
+                    value);
             });
 
-            return rewriter->template create< mlir::LLVM::AddressOfOp >(op.getLoc(),
-                                                                        target_type,
-                                                                        name);
+            return address_of(name);
         }
 
         mlir::Value make_from(
@@ -678,9 +968,25 @@ namespace vast::conv::irstollvm
         {
             auto target_type = this->convert(op.getType());
 
-            if (auto str_lit = mlir::dyn_cast< mlir::StringAttr >(op.getValue()))
-                return convert_strlit(op, rewriter_wrapper_t(rewriter), tc,
-                                      target_type, str_lit);
+            // We need to include the terminating `0` which will not happen
+            // if we "just" pass the value in.
+            if (auto str_lit = mlir::dyn_cast< mlir::StringAttr >(op.getValue())) {
+                auto value = str_lit.getValue();
+                return convert_strlit(op, rewriter_wrapper_t(rewriter), tc, target_type,
+                                      llvm::StringRef(value.data(), value.size() + 1));
+            }
+
+            // The LLVM translation takes only inline initializers, bytes of
+            // large literals are taken out of their resource blob.
+            if (auto str_lit = mlir::dyn_cast< core::StringLiteralAttr >(op.getValue())) {
+                auto blob = str_lit.getData().getRawHandle().getBlob();
+                if (!blob)
+                    return {};
+
+                auto data = blob->getData();
+                return convert_strlit(op, rewriter_wrapper_t(rewriter), tc, target_type,
+                                      llvm::StringRef(data.data(), data.size()));
+            }
 
             auto attr = convert_attr(op.getValue(), op, rewriter);
             if (!attr)
@@ -1262,6 +1568,8 @@ namespace vast::conv::irstollvm
             // Here we need to build the final value to be returned.
             auto trg_type = this->convert(gv.getType());
             auto value = construct_value(rewriter, ops.getResult().getDefiningOp(), trg_type);
+            if (!value)
+                return logical_result::failure();
 
             rewriter.template create< mlir::LLVM::ReturnOp >(
                     op.getLoc(),
@@ -1385,6 +1693,9 @@ namespace vast::conv::irstollvm
         {
             auto trg = convert(op.getResult().getType());
             auto load = rewriter.create< mlir::LLVM::LoadOp >(op.getLoc(), trg, ops.getPtr());
+            if (auto tags = op->getAttrOfType< mlir::ArrayAttr >(tbaa_attr_name)) {
+                load.setTbaaAttr(tags);
+            }
 
             rewriter.replaceOp(op, load);
             return mlir::success();
@@ -1403,6 +1714,9 @@ namespace vast::conv::irstollvm
         {
             auto store = rewriter.create< LLVM::StoreOp >(
                 op.getLoc(), ops.getVal(), ops.getPtr());
+            if (auto tags = op->getAttrOfType< mlir::ArrayAttr >(tbaa_attr_name)) {
+                store.setTbaaAttr(tags);
+            }
             rewriter.replaceOp(op, store);
             return mlir::success();
         }
@@ -1418,17 +1732,76 @@ namespace vast::conv::irstollvm
             op_t op, typename op_t::Adaptor ops,
             conversion_rewriter &rewriter) const override
         {
-            auto alloca = mk_alloca(rewriter, convert(op.getType()), op.getLoc());
+            auto alloca = mk_alloca(rewriter, op, convert(op.getType()));
             rewriter.replaceOp(op, alloca);
 
             return mlir::success();
         }
     };
 
+    template< typename op_t, typename intrinsic_t >
+    struct lifetime_marker : base_pattern< op_t >
+    {
+        using base = base_pattern< op_t >;
+        using base::base;
+
+        logical_result matchAndRewrite(
+            op_t op, typename op_t::Adaptor ops,
+            conversion_rewriter &rewriter) const override
+        {
+            auto ptr = mlir::dyn_cast< LLVM::LLVMPointerType >(
+                this->convert(op.getVar().getType())
+            );
+
+            // Storage of unknown size is not marked.
+            if (ptr && ptr.getElementType()) {
+                if (auto size = this->dl(op).getTypeSize(ptr.getElementType())) {
+                    rewriter.create< intrinsic_t >(
+                        op.getLoc(), rewriter.getI64IntegerAttr(size), ops.getVar()
+                    );
+                }
+            }
+
+            rewriter.eraseOp(op);
+            return mlir::success();
+        }
+    };
+
+    using lifetime_start = lifetime_marker< ll::LifetimeStart, LLVM::LifetimeStartOp >;
+    using lifetime_end   = lifetime_marker< ll::LifetimeEnd, LLVM::LifetimeEndOp >;
+
     using ll_memory_ops = util::type_list<
         ll_load,
         ll_store,
-        ll_alloca
+        ll_alloca,
+        lifetime_start,
+        lifetime_end
+    >;
+
+    // Branch hints are attached to the branches on the value by `ToLLCF`,
+    // what remains is the value itself.
+    template< typename op_t >
+    struct branch_hint_builtin : base_pattern< op_t >
+    {
+        using base = base_pattern< op_t >;
+        using base::base;
+
+        using adaptor_t = typename op_t::Adaptor;
+
+        logical_result matchAndRewrite(
+            op_t op, adaptor_t ops, conversion_rewriter &rewriter
+        ) const override {
+            rewriter.replaceOp(op, ops.getValue());
+            return mlir::success();
+        }
+
+        static void legalize(conversion_target &trg) { trg.addIllegalOp< op_t >(); }
+    };
+
+    using builtin_hint_conversions = util::type_list<
+        branch_hint_builtin< hlbi::ExpectOp >,
+        branch_hint_builtin< hlbi::ExpectWithProbabilityOp >,
+        branch_hint_builtin< hlbi::UnpredictableOp >
     >;
 
 
@@ -1484,7 +1857,8 @@ namespace vast::conv::irstollvm
                 lazy_op_type_conversions,
                 ll_generic_patterns,
                 ll_cf::conversions,
-                ll_memory_ops
+                ll_memory_ops,
+                builtin_hint_conversions
             >(cfg);
         }
 
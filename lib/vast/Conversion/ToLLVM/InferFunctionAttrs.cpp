@@ -0,0 +1,176 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Conversion/Passes.hpp"
+
+VAST_RELAX_WARNINGS
+#include <mlir/Dialect/LLVMIR/LLVMDialect.h>
+#include <mlir/IR/SymbolTable.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/ADT/SetVector.h>
+VAST_UNRELAX_WARNINGS
+
+#include "../PassesDetails.hpp"
+
+#include "vast/Dialect/Core/CoreAttributes.hpp"
+#include "vast/Dialect/Core/CoreDialect.hpp"
+
+#include "Common.hpp"
+
+namespace vast::conv::irstollvm
+{
+    //
+    // Direct call graph of LLVM functions in a module. Calls of anything
+    // other than a known function make the caller unknown, as nothing can be
+    // said about what it calls.
+    //
+    struct call_graph
+    {
+        explicit call_graph(mlir::ModuleOp mod) {
+            mlir::SymbolTable symbols(mod);
+
+            for (auto fn : mod.getOps< LLVM::LLVMFuncOp >()) {
+                functions.push_back(fn);
+                auto &fn_callees = callees[fn];
+
+                fn.walk([&] (LLVM::CallOp call) {
+                    auto name = call.getCallee();
+                    auto callee = name ? symbols.lookup< LLVM::LLVMFuncOp >(*name) : LLVM::LLVMFuncOp();
+                    if (!callee) {
+                        unknown.insert(fn);
+                        return;
+                    }
+
+                    if (fn_callees.insert(callee)) {
+                        callers[callee].push_back(fn);
+                    }
+                });
+            }
+        }
+
+        std::vector< LLVM::LLVMFuncOp > functions;
+        llvm::DenseMap< operation, llvm::SetVector< operation > > callees;
+        llvm::DenseMap< operation, std::vector< LLVM::LLVMFuncOp > > callers;
+        llvm::DenseSet< operation > unknown;
+    };
+
+    struct InferFunctionAttrsPass : InferFunctionAttrsBase< InferFunctionAttrsPass >
+    {
+        void runOnOperation() override {
+            auto mod = this->getOperation();
+            call_graph graph(mod);
+
+            // Nothing unwinds through C code, clang marks every function of
+            // a C module `nounwind`.
+            if (is_c_module(mod)) {
+                for (auto fn : graph.functions) {
+                    add_passthrough(fn, nounwind_attr_name);
+                }
+            } else {
+                infer_nounwind(graph);
+            }
+
+            infer_norecurse(graph);
+        }
+
+        static bool is_c_module(mlir::ModuleOp mod) {
+            auto name = core::CoreDialect::getLanguageAttrName();
+            if (auto lang = mod->getAttrOfType< core::SourceLanguageAttr >(name)) {
+                return lang.getValue() == core::SourceLanguage::C;
+            }
+            return false;
+        }
+
+        // A function does not unwind unless it calls something that may.
+        // Starting from functions that may unwind for sure, the fact is
+        // propagated to their callers, so that mutually recursive functions
+        // that call nothing else are `nounwind` as well.
+        static void infer_nounwind(const call_graph &graph) {
+            auto is_nounwind = [] (LLVM::LLVMFuncOp fn) {
+                return has_passthrough(fn, nounwind_attr_name);
+            };
+
+            llvm::DenseSet< operation > may_unwind;
+            std::vector< LLVM::LLVMFuncOp > worklist;
+
+            auto mark = [&] (LLVM::LLVMFuncOp fn) {
+                if (!is_nounwind(fn) && may_unwind.insert(fn).second) {
+                    worklist.push_back(fn);
+                }
+            };
+
+            for (auto fn : graph.functions) {
+                if (fn.isExternal() || graph.unknown.contains(fn)) {
+                    mark(fn);
+                }
+            }
+
+            while (!worklist.empty()) {
+                auto fn = worklist.back();
+                worklist.pop_back();
+
+                if (auto it = graph.callers.find(fn); it != graph.callers.end()) {
+                    for (auto caller : it->second) {
+                        mark(caller);
+                    }
+                }
+            }
+
+            for (auto fn : graph.functions) {
+                if (!may_unwind.contains(fn)) {
+                    add_passthrough(fn, nounwind_attr_name);
+                }
+            }
+        }
+
+        // A function is `norecurse` if everything it calls is. Functions are
+        // visited bottom-up, each once all its callees are known not to
+        // recurse, hence functions on a cycle of the call graph never are.
+        static void infer_norecurse(const call_graph &graph) {
+            auto is_norecurse = [] (LLVM::LLVMFuncOp fn) {
+                return has_passthrough(fn, norecurse_attr_name);
+            };
+
+            llvm::DenseMap< operation, std::size_t > pending;
+            std::vector< LLVM::LLVMFuncOp > worklist;
+
+            for (auto fn : graph.functions) {
+                if (is_norecurse(fn)) {
+                    worklist.push_back(fn);
+                } else if (!fn.isExternal() && !graph.unknown.contains(fn)) {
+                    auto it = graph.callees.find(fn);
+                    auto count = it != graph.callees.end() ? it->second.size() : 0;
+                    if (count == 0) {
+                        worklist.push_back(fn);
+                    } else {
+                        pending[fn] = count;
+                    }
+                }
+            }
+
+            while (!worklist.empty()) {
+                auto fn = worklist.back();
+                worklist.pop_back();
+                add_passthrough(fn, norecurse_attr_name);
+
+                auto it = graph.callers.find(fn);
+                if (it == graph.callers.end()) {
+                    continue;
+                }
+
+                for (auto caller : it->second) {
+                    auto count = pending.find(caller);
+                    if (count != pending.end() && --count->second == 0) {
+                        pending.erase(count);
+                        worklist.push_back(caller);
+                    }
+                }
+            }
+        }
+    };
+} // namespace vast::conv::irstollvm
+
+std::unique_ptr< mlir::Pass > vast::createInferFunctionAttrsPass() {
+    return std::make_unique< vast::conv::irstollvm::InferFunctionAttrsPass >();
+}
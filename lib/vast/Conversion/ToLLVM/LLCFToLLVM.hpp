@@ -9,6 +9,8 @@ VAST_RELAX_WARNINGS
 #include <llvm/ADT/APFloat.h>
 VAST_UNRELAX_WARNINGS
 
+#include "vast/Dialect/HighLevel/HighLevelAttributes.hpp"
+#include "vast/Dialect/LowLevel/LowLevelDialect.hpp"
 #include "vast/Dialect/LowLevel/LowLevelOps.hpp"
 
 #include "vast/Util/Symbols.hpp"
@@ -21,6 +23,109 @@ VAST_UNRELAX_WARNINGS
 
 namespace vast::conv::irstollvm::ll_cf
 {
+    using branch_weights_t = std::optional< std::pair< std::uint32_t, std::uint32_t > >;
+
+    // Weights of the true and the false successor of a conditional branch,
+    // attached to low-level branches in `ToLLCF`.
+    static inline branch_weights_t branch_weights(operation op) {
+        auto name = ll::LowLevelDialect::getBranchWeightsAttrName();
+        if (auto weights = op->getAttrOfType< mlir::DenseI32ArrayAttr >(name)) {
+            if (weights.size() == 2) {
+                return std::make_pair(std::uint32_t(weights[0]), std::uint32_t(weights[1]));
+            }
+        }
+        return std::nullopt;
+    }
+
+    // `llvm.cond_br` has no notion of unpredictable branches, the hint is kept
+    // as a dialect attribute translated to the `!unpredictable` metadata.
+    static inline void forward_unpredictable(operation from, operation to) {
+        auto name = ll::LowLevelDialect::getUnpredictableAttrName();
+        if (auto attr = from->getAttr(name)) {
+            to->setAttr(name, attr);
+        }
+    }
+
+    // `#hl.loop_hint` of a loop back edge, attached in `ToLLCF`, as the
+    // annotation translated to the `llvm.loop` metadata.
+    static inline LLVM::LoopAnnotationAttr loop_annotation(operation op) {
+        auto name  = ll::LowLevelDialect::getLoopHintAttrName();
+        auto hints = op->getAttrOfType< hl::LoopHintAttr >(name);
+        if (!hints) {
+            return {};
+        }
+
+        auto ctx = op->getContext();
+        auto disabled = [&] (mlir::BoolAttr enabled) {
+            return enabled ? mlir::BoolAttr::get(ctx, !enabled.getValue()) : mlir::BoolAttr();
+        };
+
+        LLVM::LoopVectorizeAttr vectorize;
+        if (hints.getVectorize() || hints.getVectorizeWidth()) {
+            vectorize = LLVM::LoopVectorizeAttr::get(ctx,
+                /* disable */ disabled(hints.getVectorize()),
+                /* predicateEnable */ {}, /* scalableEnable */ {},
+                /* width */ hints.getVectorizeWidth(),
+                /* followupVectorized */ {}, /* followupEpilogue */ {}, /* followupAll */ {}
+            );
+        }
+
+        LLVM::LoopInterleaveAttr interleave;
+        if (auto count = hints.getInterleaveCount()) {
+            interleave = LLVM::LoopInterleaveAttr::get(ctx, count);
+        }
+
+        // An enabled unroll is forwarded by `forward_loop_hints`, the annotation
+        // has only the disabled state.
+        LLVM::LoopUnrollAttr unroll;
+        auto unroll_disabled = hints.getUnroll() && !hints.getUnroll().getValue();
+        if (unroll_disabled || hints.getUnrollCount() || hints.getUnrollFull()) {
+            unroll = LLVM::LoopUnrollAttr::get(ctx,
+                /* disable */ unroll_disabled ? mlir::BoolAttr::get(ctx, true) : mlir::BoolAttr(),
+                /* count */ hints.getUnrollCount(),
+                /* runtimeDisable */ {},
+                /* full */ hints.getUnrollFull(),
+                /* followupUnrolled */ {}, /* followupRemainder */ {}, /* followupAll */ {}
+            );
+        }
+
+        LLVM::LoopDistributeAttr distribute;
+        if (auto enabled = hints.getDistribute()) {
+            distribute = LLVM::LoopDistributeAttr::get(ctx,
+                /* disable */ disabled(enabled),
+                /* followupCoincident */ {}, /* followupSequential */ {},
+                /* followupFallback */ {}, /* followupAll */ {}
+            );
+        }
+
+        return LLVM::LoopAnnotationAttr::get(ctx,
+            /* disableNonforced */ {}, vectorize, interleave, unroll,
+            /* unrollAndJam */ {}, /* licm */ {}, distribute,
+            /* pipeline */ {}, /* peeled */ {}, /* unswitch */ {},
+            /* mustProgress */ hints.getMustprogress(),
+            /* isVectorized */ {}, /* startLoc */ {}, /* endLoc */ {},
+            /* parallelAccesses */ {}
+        );
+    }
+
+    // `llvm.loop` has no counterpart of `llvm.loop.unroll.enable` of a bare
+    // `#pragma unroll`, the hint is kept as a dialect attribute translated
+    // together with the rest of the loop metadata.
+    static inline void forward_loop_hints(operation from, LLVM::BrOp to) {
+        if (auto annotation = loop_annotation(from)) {
+            to.setLoopAnnotationAttr(annotation);
+        }
+
+        auto name  = ll::LowLevelDialect::getLoopHintAttrName();
+        auto hints = from->getAttrOfType< hl::LoopHintAttr >(name);
+        if (hints && hints.getUnroll() && hints.getUnroll().getValue()) {
+            to->setAttr(
+                ll::LowLevelDialect::getUnrollEnableAttrName(),
+                mlir::UnitAttr::get(from->getContext())
+            );
+        }
+    }
+
     struct br : base_pattern< ll::Br >
     {
         using base = base_pattern< ll::Br >;
@@ -33,7 +138,8 @@ namespace vast::conv::irstollvm::ll_cf
                     op_t op, adaptor_t ops,
                     conversion_rewriter &rewriter) const override
         {
-            rewriter.create< LLVM::BrOp >(op.getLoc(), ops.getOperands(), op.getDest());
+            auto br = rewriter.create< LLVM::BrOp >(op.getLoc(), ops.getOperands(), op.getDest());
+            forward_loop_hints(op, br);
             rewriter.eraseOp(op);
 
             return mlir::success();
@@ -53,12 +159,14 @@ namespace vast::conv::irstollvm::ll_cf
             op_t op, adaptor_t ops,
             conversion_rewriter &rewriter) const override
         {
-            rewriter.create< LLVM::CondBrOp >(
+            auto br = rewriter.create< LLVM::CondBrOp >(
                 op.getLoc(),
                 ops.getCond(),
                 op.getTrueDest() , ops.getTrueOperands(),
-                op.getFalseDest(), ops.getFalseOperands()
+                op.getFalseDest(), ops.getFalseOperands(),
+                branch_weights(op)
             );
+            forward_unpredictable(op, br);
             rewriter.eraseOp( op );
 
             return mlir::success();
@@ -66,6 +174,37 @@ namespace vast::conv::irstollvm::ll_cf
 
     };
 
+    struct switch_op : base_pattern< ll::Switch >
+    {
+        using base = base_pattern< ll::Switch >;
+        using base::base;
+
+        using op_t = ll::Switch;
+        using adaptor_t = typename op_t::Adaptor;
+
+        logical_result matchAndRewrite(
+            op_t op, adaptor_t ops,
+            conversion_rewriter &rewriter) const override
+        {
+            auto case_values = llvm::to_vector(op.getCaseValues().getValues< llvm::APInt >());
+            auto case_dests  = op.getCaseDests();
+
+            // Successors of `ll.switch` do not take operands.
+            llvm::SmallVector< mlir::ValueRange > case_operands(case_dests.size());
+
+            rewriter.create< LLVM::SwitchOp >(
+                op.getLoc(),
+                ops.getValue(),
+                op.getDefaultDest(), mlir::ValueRange(),
+                case_values, case_dests, case_operands
+            );
+            rewriter.eraseOp(op);
+
+            return mlir::success();
+        }
+
+    };
+
     template< typename Op >
     struct scope_like : base_pattern< Op >
     {
@@ -88,13 +227,15 @@ namespace vast::conv::irstollvm::ll_cf
             if (auto ret = mlir::dyn_cast< ll::ScopeRet >(last)) {
                 make_after_op< LLVM::BrOp >(rewriter, &last, last.getLoc(), no_vals, &end);
             } else if (auto ret = mlir::isa< ll::ScopeRecurse >(last)) {
-                make_after_op< LLVM::BrOp >(rewriter, &last, last.getLoc(),
-                                            no_vals, &start);
+                auto br = make_after_op< LLVM::BrOp >(rewriter, &last, last.getLoc(),
+                                                      no_vals, &start);
+                forward_loop_hints(&last, br);
             } else if (auto ret = mlir::dyn_cast< ll::CondScopeRet >(last)) {
-                make_after_op< LLVM::CondBrOp >(rewriter, &last, last.getLoc(),
-                                                ret.getCond(),
-                                                ret.getDest(), ret.getDestOperands(),
-                                                &end, no_vals);
+                auto br = make_after_op< LLVM::CondBrOp >(rewriter, &last, last.getLoc(),
+                                                          ret.getCond(),
+                                                          ret.getDest(), ret.getDestOperands(),
+                                                          &end, no_vals, branch_weights(ret));
+                forward_unpredictable(ret, br);
             } else {
                 // Nothing to do (do not erase, since it is a standard branching).
                 return mlir::success();
@@ -172,6 +313,7 @@ namespace vast::conv::irstollvm::ll_cf
     using conversions = util::type_list<
           cond_br
         , br
+        , switch_op
         , scope
     >;
 
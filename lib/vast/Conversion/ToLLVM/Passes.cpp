@@ -11,6 +11,15 @@ VAST_UNRELAX_WARNINGS
 
 namespace vast::conv::pipeline {
 
+    static pipeline_step_ptr emit_tbaa() {
+        return pass(createEmitTBAAPass)
+            .depends_on(abi);
+    }
+
+    pipeline_step_ptr tbaa() {
+        return compose("tbaa", emit_tbaa);
+    }
+
     pipeline_step_ptr irs_to_llvm() {
         return pass(createIRsToLLVMPass)
             .depends_on(abi);
@@ -72,11 +72,24 @@ namespace vast::core
             return mlir::failure();
         }
 
-        // TODO: Add the attributes to the function arguments.
-        // VAST_ASSERT(result_attrs.size() == result_types.size());
-        // return mlir::function_interface_impl::addArgAndResultAttrs(
-        //     builder, state, arguments, result_attrs
-        // );
+        // Argument and result attributes are printed inline with the
+        // signature, hence we need to collect them back.
+        auto &builder = parser.getBuilder();
+        auto add_attr_dicts = [&] (llvm::StringRef name, auto &&dicts) {
+            auto non_empty = [] (mlir::DictionaryAttr dict) { return dict && !dict.empty(); };
+            if (llvm::none_of(dicts, non_empty))
+                return;
+
+            llvm::SmallVector< Attribute, 8 > attrs;
+            for (auto dict : dicts)
+                attrs.push_back(dict ? dict : builder.getDictionaryAttr({}));
+            attr_dict.append(name, builder.getArrayAttr(attrs));
+        };
+
+        add_attr_dicts("arg_attrs", llvm::map_range(arguments, [] (const auto &arg) {
+            return arg.attrs;
+        }));
+        add_attr_dicts("res_attrs", result_attrs);
 
         auto loc = parser.getCurrentLocation();
         auto parse_result = parser.parseOptionalRegion(
@@ -3,6 +3,7 @@
 #include "vast/Dialect/HighLevel/HighLevelAttributes.hpp"
 #include "vast/Dialect/HighLevel/HighLevelTypes.hpp"
 #include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/HighLevel/TypeDefinitionIndex.hpp"
 #include "vast/Util/TypeList.hpp"
 #include <sstream>
 
@@ -115,6 +116,19 @@ namespace vast::hl
         return {};
     }
 
+    core::FunctionType getFunctionType(mlir_type type, const type_definition_index &defs) {
+        if (!type)
+            return {};
+        if (auto ty = type.dyn_cast< core::FunctionType >())
+            return ty;
+        if (auto ty = dyn_cast< ElementTypeInterface >(type))
+            return getFunctionType(ty.getElementType(), defs);
+        if (auto ty = type.dyn_cast< TypedefType >())
+            return getFunctionType(defs.typedef_type(ty), defs);
+
+        return {};
+    }
+
 
     void HighLevelDialect::registerTypes() {
         addTypes<
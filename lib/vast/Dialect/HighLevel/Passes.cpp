@@ -16,7 +16,7 @@ namespace vast::hl::pipeline {
     // canonicalization pipeline passes
     //
     static pipeline_step_ptr splice_trailing_scopes() {
-        return pass(hl::createSpliceTrailingScopes);
+        return nested< hl::FuncOp >(hl::createSpliceTrailingScopes);
     }
 
     // TODO: add more passes here (remove reduntant skips etc.)
@@ -45,7 +45,7 @@ namespace vast::hl::pipeline {
     // simplifcaiton passes
     //
     static pipeline_step_ptr dce() {
-        return pass(hl::createDCEPass).depends_on(canonicalize);
+        return nested< hl::FuncOp >(hl::createDCEPass).depends_on(canonicalize);
     }
 
     static pipeline_step_ptr ude() {
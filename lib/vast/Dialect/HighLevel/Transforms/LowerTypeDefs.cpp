@@ -25,6 +25,7 @@ VAST_UNRELAX_WARNINGS
 
 #include "vast/Dialect/HighLevel/HighLevelDialect.hpp"
 #include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/HighLevel/TypeDefinitionIndex.hpp"
 
 #include "PassesDetails.hpp"
 
@@ -37,12 +38,12 @@ namespace vast::hl {
                 : conv::tc::base_type_converter
                 , conv::tc::mixins< type_converter >
             {
-                vast_module mod;
+                const type_definition_index &defs;
                 mcontext_t &mctx;
 
-                type_converter(mcontext_t &mctx, vast_module mod)
+                type_converter(mcontext_t &mctx, const type_definition_index &defs)
                     : conv::tc::base_type_converter(),
-                      mod(mod), mctx(mctx)
+                      defs(defs), mctx(mctx)
                 {
                     addConversion([&](mlir_type t) { return this->convert(t); });
                 }
@@ -55,9 +56,8 @@ namespace vast::hl {
                     return {};
                 }
 
-                // TODO(conv): This may need to be precomputed instead.
                 maybe_type_t nested_type(mlir_type type) {
-                    return hl::getBottomTypedefType(type, mod);
+                    return defs.bottom_typedef_type(type);
                 }
 
                 maybe_type_t convert(mlir_type type) {
@@ -115,7 +115,9 @@ namespace vast::hl {
 
             rewrite_pattern_set patterns(&mctx);
 
-            auto tc = pattern::type_converter(mctx, op);
+            const auto &defs = getAnalysis< type_definition_index >();
+
+            auto tc = pattern::type_converter(mctx, defs);
             patterns.template add< pattern::resolve_typedef >(tc, mctx);
 
             if (mlir::failed(mlir::applyPartialConversion(op, target, std::move(patterns)))) {
@@ -13,6 +13,7 @@ VAST_UNRELAX_WARNINGS
 #include "vast/Dialect/LowLevel/LowLevelDialect.hpp"
 #include "vast/Dialect/Core/CoreDialect.hpp"
 
+#include "vast/Dialect/HighLevel/HighLevelOps.hpp"
 #include "vast/Dialect/HighLevel/Passes.hpp"
 
 #include <memory>
@@ -9,6 +9,9 @@ VAST_RELAX_WARNINGS
 #include <mlir/Rewrite/FrozenRewritePatternSet.h>
 #include <mlir/Transforms/DialectConversion.h>
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
+#include <llvm/ADT/SetVector.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/TypeSwitch.h>
 VAST_UNRELAX_WARNINGS
 
 #include <gap/coro/generator.hpp>
@@ -23,7 +26,6 @@ VAST_UNRELAX_WARNINGS
 
 #include "PassesDetails.hpp"
 
-#include <unordered_set>
 
 namespace vast::hl {
 
@@ -36,104 +38,159 @@ namespace vast::hl {
 
     constexpr bool keep_only_if_used = false;
 
-    template< typename yield_t >
-    walk_result users(hl::FieldDeclOp decl, auto scope, yield_t &&yield) {
-        return hl::users(decl.getParentAggregate(), scope, std::forward< yield_t >(yield));
-    }
-
-    struct UDE : UDEBase< UDE >
+    //
+    // Module-wide index of top-level declarations and their uses. It is built
+    // by a single walk of the module: every use (of a record or typedef name,
+    // a global variable or a function symbol) is attributed to the top-level
+    // operation that contains it, yielding a dependency graph between
+    // top-level operations.
+    //
+    struct use_index
     {
-        using base = UDEBase< UDE >;
-
-        std::unordered_set< operation > unused_cached;
+        explicit use_index(vast_module mod) {
+            for (auto &op : mod.getOps()) {
+                register_definition(&op);
+            }
 
-        bool keep(aggregate_interface op, auto scope) const { return keep_only_if_used; }
-        bool keep(hl::TypeDefOp op, auto scope)       const { return keep_only_if_used; }
-        bool keep(hl::TypeDeclOp op, auto scope)      const { return keep_only_if_used; }
+            mod.walk([&](operation op) {
+                if (op != mod) {
+                    record_uses(op, top_level_ancestor(op, mod));
+                }
+            });
+        }
 
-        // Mark field to be kept if the parent aggregate is kept
-        bool keep(hl::FieldDeclOp op, auto scope) const { return keep(op.getParentAggregate(), scope); }
+        // Top-level operations used by `op`.
+        llvm::ArrayRef< operation > dependencies(operation op) const {
+            if (auto it = edges.find(op); it != edges.end()) {
+                return it->second.getArrayRef();
+            }
+            return {};
+        }
 
-        bool keep(hl::FuncOp op, auto scope) const {
-            return !op.isDeclaration() && !util::has_attr< hl::AlwaysInlineAttr >(op);
+      private:
+        void register_definition(operation op) {
+            llvm::TypeSwitch< operation >(op)
+                .Case([&](aggregate_interface agg) { records[agg.getDefinedName()].push_back(op); })
+                .Case([&](hl::TypeDeclOp decl)     { records[decl.getName()].push_back(op); })
+                .Case([&](hl::TypeDefOp def)       { typedefs[def.getName()].push_back(op); })
+                .Case([&](hl::VarDeclOp var)       { globals[var.getName()].push_back(op); })
+                .Case([&](hl::FuncOp fn)           { functions[fn.getSymName()].push_back(op); });
         }
 
-        bool keep(hl::VarDeclOp op, auto scope) const {
-            VAST_CHECK(!op.hasExternalStorage() || op.getInitializer().empty(), "extern variable with initializer");
-            return !op.hasExternalStorage();
+        static operation top_level_ancestor(operation op, vast_module mod) {
+            while (op->getParentOp() != mod) {
+                op = op->getParentOp();
+            }
+            return op;
         }
 
-        bool is_unused_impl(auto op, auto scope, auto &seen) {
-            if (keep(op, scope)) {
-                VAST_UDE_DEBUG("keep: {0}", *op);
-                return false;
+        void add_edges(operation user, const auto &definitions, string_ref name) {
+            auto it = definitions.find(name);
+            if (it == definitions.end()) {
+                return;
             }
 
-            auto result = hl::users(op, scope, [&](operation user) -> walk_result {
-                VAST_UDE_DEBUG("user: {0} of {1}", *user, *op);
-                // Ignore top-level use
-                if (user == scope) {
-                    return walk_result::advance();
+            for (auto def : it->second) {
+                if (def != user) {
+                    edges[user].insert(def);
                 }
+            }
+        }
 
-                if (is_unused(user, scope, seen)) {
-                    VAST_UDE_DEBUG("unused user: {0}", *user);
-                    return walk_result::advance();
+        void record_uses(operation op, operation owner) {
+            has_type_somewhere(op, [&](mlir_type type) {
+                if (auto rt = mlir::dyn_cast< RecordType >(type)) {
+                    add_edges(owner, records, rt.getName());
+                } else if (auto td = mlir::dyn_cast< TypedefType >(type)) {
+                    add_edges(owner, typedefs, td.getName());
                 }
+                // Visit all subtypes.
+                return false;
+            });
 
-                // If the user is an always inlined function that is not used,
-                // we mark it as unused.
-                if (auto parent = user->template getParentOfType< hl::FuncOp >()) {
-                    if (is_unused(parent, scope, seen)) {
-                        VAST_UDE_DEBUG("user in always inlined function: {0}", *user);
-                        return walk_result::advance();
-                    }
-                }
+            if (auto ref = mlir::dyn_cast< GlobalRefOp >(op)) {
+                add_edges(owner, globals, ref.getGlobal());
+            }
 
-                // We interrupt the walk if the operation is used
-                return walk_result::interrupt();
+            mlir::AttrTypeWalker walker;
+            walker.addWalk([&](mlir::SymbolRefAttr sym) {
+                add_edges(owner, functions, sym.getRootReference());
             });
+            walker.walk(op->getAttrDictionary());
+        }
 
-            // Operation is used if the walk was interrupted so we need to keep it.
-            return !result.wasInterrupted();
+        using definitions_t = llvm::StringMap< llvm::SmallVector< operation, 1 > >;
+
+        definitions_t records;
+        definitions_t typedefs;
+        definitions_t globals;
+        definitions_t functions;
+
+        llvm::DenseMap< operation, llvm::SmallSetVector< operation, 4 > > edges;
+    };
+
+    struct UDE : UDEBase< UDE >
+    {
+        using base = UDEBase< UDE >;
+
+        bool keep(aggregate_interface op) const { return keep_only_if_used; }
+        bool keep(hl::TypeDefOp op)       const { return keep_only_if_used; }
+        bool keep(hl::TypeDeclOp op)      const { return keep_only_if_used; }
+
+        bool keep(hl::FuncOp op) const {
+            return !op.isDeclaration() && !util::has_attr< hl::AlwaysInlineAttr >(op);
         }
 
-        bool is_unused(operation op, auto scope, auto &seen) {
-            if (unused_cached.contains(op)) {
-                VAST_UDE_DEBUG("cached: {0}", *op);
-                return true;
-            }
+        bool keep(hl::VarDeclOp op) const {
+            VAST_CHECK(!op.hasExternalStorage() || op.getInitializer().empty(), "extern variable with initializer");
+            return !op.hasExternalStorage();
+        }
+
+        // Operations that are not declarations are always kept.
+        bool is_kept(operation op) const {
+            return llvm::TypeSwitch< operation, bool >(op)
+                .Case([&](aggregate_interface op) { return keep(op); })
+                .Case([&](hl::TypeDefOp op)       { return keep(op); })
+                .Case([&](hl::TypeDeclOp op)      { return keep(op); })
+                .Case([&](hl::FuncOp op)          { return keep(op); })
+                .Case([&](hl::VarDeclOp op)       { return keep(op); })
+                .Default([&](operation)           { return true; });
+        }
 
-            if (const auto [_, inserted] = seen.insert(op); !inserted) {
-                VAST_UDE_DEBUG("recursive: {0}", *op);
-                // Already processed, the operation has recursive dependency.
-                // We can safely return true here, as some other user
-                // needs to determine if the operation is to be kept.
-                return true;
+        // Everything reachable from kept top-level operations is used. Uses
+        // nested in an unused operation (e.g., in the body of an unused
+        // always inlined function) do not keep their definitions alive.
+        llvm::DenseSet< operation > gather_used(vast_module mod, const use_index &uses) {
+            llvm::DenseSet< operation > used;
+            llvm::SmallVector< operation > worklist;
+
+            for (auto &op : mod.getOps()) {
+                if (is_kept(&op)) {
+                    VAST_UDE_DEBUG("keep: {0}", op);
+                    used.insert(&op);
+                    worklist.push_back(&op);
+                }
             }
 
-            VAST_UDE_DEBUG("processing: {0}", *op);
-            bool result = llvm::TypeSwitch< operation, bool >(op)
-                .Case([&](aggregate_interface op) { return is_unused_impl(op, scope, seen); })
-                .Case([&](hl::FieldDeclOp op)     { return is_unused_impl(op, scope, seen); })
-                .Case([&](hl::TypeDefOp op)       { return is_unused_impl(op, scope, seen); })
-                .Case([&](hl::TypeDeclOp op)      { return is_unused_impl(op, scope, seen); })
-                .Case([&](hl::FuncOp op)          { return is_unused_impl(op, scope, seen); })
-                .Case([&](hl::VarDeclOp op)       { return is_unused_impl(op, scope, seen); })
-                .Default([&](operation)           { return false; });
-
-            if (result) {
-                unused_cached.insert(op);
+            while (!worklist.empty()) {
+                auto op = worklist.pop_back_val();
+                for (auto dep : uses.dependencies(op)) {
+                    if (auto [_, inserted] = used.insert(dep); inserted) {
+                        VAST_UDE_DEBUG("used: {0} by {1}", *dep, *op);
+                        worklist.push_back(dep);
+                    }
+                }
             }
 
-            return result;
+            return used;
         }
 
-        std::vector< operation > gather_unused(auto scope) {
+        std::vector< operation > gather_unused(vast_module mod) {
+            auto used = gather_used(mod, use_index(mod));
+
             std::vector< operation > unused_operations;
-            for (auto &op : scope.getOps()) {
-                std::unordered_set< operation > seen;
-                if (is_unused(&op, scope, seen)) {
+            for (auto &op : mod.getOps()) {
+                if (!used.contains(&op)) {
                     unused_operations.push_back(&op);
                 }
             }
@@ -166,10 +223,12 @@ namespace vast::hl {
                 });
             };
 
-            dl::filter_data_layout(mod, [&] (const auto &entry) {
-                auto type = entry.getKey().template get< mlir_type >();
-                return !contains_unused_subtype(type);
-            });
+            if (!unused_types.empty()) {
+                dl::filter_data_layout(mod, [&] (const auto &entry) {
+                    auto type = entry.getKey().template get< mlir_type >();
+                    return !contains_unused_subtype(type);
+                });
+            }
 
             for (auto op : unused) {
                 op->erase();
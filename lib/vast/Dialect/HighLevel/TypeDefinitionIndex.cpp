@@ -0,0 +1,62 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Dialect/HighLevel/TypeDefinitionIndex.hpp"
+
+namespace vast::hl
+{
+    type_definition_index::type_definition_index(operation scope)
+    {
+        scope->walk([&] (operation op) { insert(op); });
+    }
+
+    void type_definition_index::insert(operation op)
+    {
+        // Mirrors the order in which the module walks resolved the names:
+        // the first record wins, while typedefs are overwritten by later ones.
+        if (auto agg = mlir::dyn_cast< AggregateTypeDefinitionInterface >(op)) {
+            records.try_emplace(agg.getDefinedName(), agg);
+        } else if (auto def = mlir::dyn_cast< TypeDefOp >(op)) {
+            typedefs.insert_or_assign(def.getName(), def);
+        } else if (auto decl = mlir::dyn_cast< EnumDeclOp >(op)) {
+            enums.try_emplace(decl.getName(), decl);
+        }
+    }
+
+    AggregateTypeDefinitionInterface type_definition_index::record(string_ref name) const
+    {
+        return records.lookup(name);
+    }
+
+    TypeDefOp type_definition_index::typedef_decl(string_ref name) const
+    {
+        return typedefs.lookup(name);
+    }
+
+    EnumDeclOp type_definition_index::enum_decl(string_ref name) const
+    {
+        return enums.lookup(name);
+    }
+
+    AggregateTypeDefinitionInterface type_definition_index::definition_of(mlir_type type) const
+    {
+        auto naked_type = strip_elaborated(strip_value_category(type));
+        if (auto record_type = mlir::dyn_cast_or_null< RecordType >(naked_type))
+            return record(record_type.getName());
+        return {};
+    }
+
+    mlir_type type_definition_index::typedef_type(TypedefType type) const
+    {
+        if (auto def = typedef_decl(type.getName()))
+            return def.getType();
+        return {};
+    }
+
+    mlir_type type_definition_index::bottom_typedef_type(mlir_type type) const
+    {
+        while (auto def = mlir::dyn_cast_or_null< TypedefType >(strip_elaborated(type)))
+            type = typedef_type(def);
+        return type;
+    }
+
+} // namespace vast::hl
@@ -28,14 +28,18 @@ namespace vast::cc {
 
         bool emit_only_llvm(const vast_args &vargs) { return vargs.has_option(emit_llvm); }
 
+        bool emit_bytecode(const vast_args &vargs) {
+            return vargs.has_option(emit_mlir) && vargs.has_option(emit_mlir_bytecode);
+        }
+
     } // namespace opt
 
-    static std::string get_output_stream_suffix(output_type act) {
+    std::string get_output_stream_suffix(output_type act, const vast_args &vargs) {
         switch (act) {
             case output_type::emit_assembly:
                 return "s";
             case output_type::emit_mlir:
-                return "mlir";
+                return opt::emit_bytecode(vargs) ? "mlirbc" : "mlir";
             case output_type::emit_llvm:
                 return "ll";
             case output_type::emit_obj:
@@ -47,14 +51,15 @@ namespace vast::cc {
         VAST_FATAL("unsupported action type");
     }
 
-    static auto get_output_stream(compiler_instance &ci, string_ref in, output_type act)
-        -> output_stream_ptr
-    {
+    static auto get_output_stream(
+        compiler_instance &ci, string_ref in, output_type act, const vast_args &vargs
+    ) -> output_stream_ptr {
         if (act == output_type::none) {
             return nullptr;
         }
 
-        return ci.createDefaultOutputFile(false, in, get_output_stream_suffix(act));
+        bool binary = act == output_type::emit_mlir && opt::emit_bytecode(vargs);
+        return ci.createDefaultOutputFile(binary, in, get_output_stream_suffix(act, vargs));
     }
 
     vast_stream_action::vast_stream_action(output_type act, const vast_args &vargs)
@@ -71,7 +76,7 @@ namespace vast::cc {
     {
         auto out = ci.takeOutputStream();
         if (!out) {
-            out = get_output_stream(ci, input, action);
+            out = get_output_stream(ci, input, action, vargs);
         }
 
         auto result = std::make_unique< vast_stream_consumer >(
@@ -17,6 +17,9 @@ VAST_UNRELAX_WARNINGS
 #include "vast/CodeGen/CodeGenContext.hpp"
 #include "vast/CodeGen/CodeGenDriver.hpp"
 
+#include "vast/Dialect/Dialects.hpp"
+
+#include "vast/Util/Bytecode.hpp"
 #include "vast/Util/Common.hpp"
 
 #include "vast/Frontend/Pipelines.hpp"
@@ -32,14 +35,46 @@ namespace vast::cc {
 
     void emit_mlir_output(target_dialect target, owning_module_ref mod, mcontext_t *mctx);
 
+    // Registry is built once per process and shared by contexts of all
+    // translation units (e.g., in batch mode).
+    static const mlir::DialectRegistry &dialect_registry() {
+        static const auto registry = [] {
+            mlir::DialectRegistry registry;
+            vast::registerAllDialects(registry);
+            vast::registerDependentDialects(registry);
+            return registry;
+        } ();
+
+        return registry;
+    }
+
+    static mcontext_t::Threading threading(const vast_args &vargs) {
+        return vargs.has_option(opt::disable_multithreading)
+            ? mcontext_t::Threading::DISABLED
+            : mcontext_t::Threading::ENABLED;
+    }
+
     void vast_consumer::Initialize(acontext_t &actx) {
         VAST_CHECK(!mctx, "initialized multiple times");
-        mctx = std::make_unique< mcontext_t >();
+        mctx = std::make_unique< mcontext_t >(dialect_registry(), threading(vargs));
         cgctx = std::make_unique< cg::codegen_context >(
             *mctx, actx, get_source_language(opts.lang)
         );
+        cgctx->finite_loops = opts.codegen.getFiniteLoops();
 
         codegen = std::make_unique< cg::codegen_driver >(*cgctx, opts, vargs);
+
+        if (vargs.has_option(opt::stats)) {
+            VAST_CHECK(vargs.get_option(opt::stats), "expected path to stats file");
+            stats = std::make_unique< compilation_stats >();
+            frontend_start = compilation_stats::times::now();
+        }
+
+        if (vargs.has_option(opt::trace)) {
+            VAST_CHECK(vargs.get_option(opt::trace), "expected path to trace file");
+            tracer = std::make_unique< trace::recorder >();
+            codegen->set_tracer(tracer.get());
+        }
     }
 
     bool vast_consumer::HandleTopLevelDecl(clang::DeclGroupRef decls) {
@@ -52,6 +87,7 @@ namespace vast::cc {
             return true;
         }
 
+        compilation_stats::phase_scope scope(stats.get(), "codegen");
         return codegen->handle_top_level_decl(decls), true;
     }
 
@@ -71,8 +107,24 @@ namespace vast::cc {
         // Note that this method is called after `HandleTopLevelDecl` has already
         // ran all over the top level decls. Here clang mostly wraps defered and
         // global codegen, followed by running vast passes.
+        if (stats) {
+            // Clang parses the source interleaved with the codegen of top
+            // level declarations, parse time is what remains after codegen.
+            auto parse = compilation_stats::times::now();
+            parse -= frontend_start;
+            parse -= stats->phase_time("codegen");
+            stats->add_phase("parse", parse);
+        }
+
+        compilation_stats::phase_scope scope(stats.get(), "codegen");
         codegen->finalize();
 
+        if (stats) {
+            stats->add_counter("type_cache_hits", cgctx->types.hits);
+            stats->add_counter("type_cache_misses", cgctx->types.misses);
+            stats->add_counter("avoided_manglings", cgctx->mangler.avoided_manglings());
+        }
+
         if (!vargs.has_option(opt::disable_vast_verifier)) {
             if (!codegen->verify_module()) {
                 VAST_FATAL("codegen: module verification error before running vast passes");
@@ -114,6 +166,7 @@ namespace vast::cc {
     // }
 
     void vast_consumer::CompleteTentativeDefinition(clang::VarDecl *decl) {
+        compilation_stats::phase_scope scope(stats.get(), "codegen");
         codegen->handle_top_level_decl(decl);
     }
 
@@ -131,14 +184,32 @@ namespace vast::cc {
         return std::move(cgctx->mod);
     }
 
+    void vast_consumer::write_stats() const {
+        if (stats) {
+            // failure is reported, but does not affect the compilation
+            (void) stats->write(vargs.get_option(opt::stats).value());
+        }
+    }
+
+    void vast_consumer::write_trace() const {
+        if (tracer) {
+            // failure is reported, but does not affect the compilation
+            (void) tracer->write(vargs.get_option(opt::trace).value());
+        }
+    }
+
     //
     // vast stream consumer
     //
 
     void vast_stream_consumer::HandleTranslationUnit(acontext_t &actx) {
         base::HandleTranslationUnit(actx);
-        auto mod = result();
+        emit_output(result());
+        write_stats();
+        write_trace();
+    }
 
+    void vast_stream_consumer::emit_output(owning_module_ref mod) {
         switch (action) {
             case output_type::emit_assembly:
                 return emit_backend_output(
@@ -170,9 +241,16 @@ namespace vast::cc {
 
         process_mlir_module(target_dialect::llvm, mlir_module.get(), mctx);
 
-        auto mod = target::llvmir::translate(mlir_module.get(), llvm_context);
+        auto mod = [&] {
+            compilation_stats::phase_scope scope(stats.get(), "llvm-translation");
+            trace::scope span(tracer.get(), "phase", "llvm-translation");
+            return target::llvmir::translate(mlir_module.get(), llvm_context);
+        } ();
+
         auto dl  = cgctx->actx.getTargetInfo().getDataLayoutString();
 
+        compilation_stats::phase_scope scope(stats.get(), "backend");
+        trace::scope span(tracer.get(), "phase", "backend");
         clang::EmitBackendOutput(
             opts.diags, opts.headers, opts.codegen, opts.target, opts.lang, dl, mod.get(),
             backend_action, &opts.vfs, std::move(output_stream)
@@ -204,11 +282,30 @@ namespace vast::cc {
             llvm::DebugFlag = true;
         }
 
+        // Type-based alias analysis is not allowed with `-fno-strict-aliasing`.
+        auto pipeline_args = vargs;
+        if (opts.codegen.RelaxedAliasing) {
+            pipeline_args.push_back("-vast-disable-tbaa");
+        }
+
         // Setup and execute vast pipeline
-        auto pipeline = setup_pipeline(pipeline_source::ast, target, *mctx, vargs);
+        auto pipeline = setup_pipeline(pipeline_source::ast, target, *mctx, pipeline_args);
         VAST_CHECK(pipeline, "failed to setup pipeline");
 
-        auto result = pipeline->run(mod);
+        if (stats) {
+            stats->instrument(*pipeline);
+        }
+
+        if (tracer) {
+            tracer->instrument(*pipeline);
+        }
+
+        auto result = [&] {
+            compilation_stats::phase_scope scope(stats.get(), "pipeline");
+            trace::scope span(tracer.get(), "phase", "pipeline");
+            return pipeline->run(mod);
+        } ();
+
         VAST_CHECK(mlir::succeeded(result), "MLIR pass manager failed when running vast passes");
 
         // Verify the diagnostic handler to make sure that each of the
@@ -233,6 +330,12 @@ namespace vast::cc {
 
         process_mlir_module(target, mod.get(), mctx);
 
+        compilation_stats::phase_scope scope(stats.get(), "emit-mlir");
+        trace::scope span(tracer.get(), "phase", "emit-mlir");
+        if (opt::emit_bytecode(vargs)) {
+            return emit_mlir_bytecode(mod.get());
+        }
+
         // FIXME: we cannot roundtrip prettyForm=true right now.
         mlir::OpPrintingFlags flags;
         flags.enableDebugInfo(vargs.has_option(opt::show_locs), /* prettyForm */ true);
@@ -240,4 +343,22 @@ namespace vast::cc {
         mod->print(*output_stream, flags);
     }
 
+    static std::optional< std::int64_t > get_bytecode_version(const vast_args &vargs) {
+        if (auto value = vargs.get_option(opt::emit_mlir_bytecode)) {
+            std::int64_t version = 0;
+            if (value->getAsInteger(10, version)) {
+                VAST_FATAL("invalid bytecode version: {0}", value.value());
+            }
+
+            return version;
+        }
+
+        return std::nullopt;
+    }
+
+    void vast_stream_consumer::emit_mlir_bytecode(vast_module mod) {
+        auto result = write_bytecode(mod, *output_stream, get_bytecode_version(vargs));
+        VAST_CHECK(mlir::succeeded(result), "failed to emit MLIR bytecode");
+    }
+
 } // namespace vast::cc
@@ -17,9 +17,11 @@ namespace vast::cc {
         }
 
         std::optional< string_ref > get_option_impl(argv_t args, string_ref name) {
+            // the name has to match exactly, so that e.g. "emit-mlir" does not
+            // match "emit-mlir-bytecode"
             auto is_opt_with_name = [] (auto name) {
                 return [name] (auto arg) {
-                    return name_and_value_view(arg).startswith(name);
+                    return name_and_value_view(arg).split('=').first == name;
                 };
             };
 
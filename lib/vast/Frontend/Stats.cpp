@@ -0,0 +1,242 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Frontend/Stats.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/Timer.h>
+#include <mlir/Pass/PassInstrumentation.h>
+VAST_UNRELAX_WARNINGS
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+#endif
+
+namespace vast::cc {
+
+    using times = compilation_stats::times;
+
+    times &times::operator+=(const times &other) {
+        wall += other.wall;
+        cpu  += other.cpu;
+        return *this;
+    }
+
+    times &times::operator-=(const times &other) {
+        wall -= other.wall;
+        cpu  -= other.cpu;
+        return *this;
+    }
+
+    times times::now() {
+        auto record = llvm::TimeRecord::getCurrentTime();
+        return { record.getWallTime(), record.getUserTime() + record.getSystemTime() };
+    }
+
+    compilation_stats::phase_scope::phase_scope(compilation_stats *stats, string_ref name)
+        : stats(stats), name(name.str())
+    {
+        if (stats) {
+            start = times::now();
+        }
+    }
+
+    compilation_stats::phase_scope::~phase_scope() {
+        if (stats) {
+            auto elapsed = times::now();
+            elapsed -= start;
+            stats->add_phase(name, elapsed);
+        }
+    }
+
+    void compilation_stats::add_phase(string_ref name, const times &time) {
+        auto it = llvm::find_if(phases, [&] (const auto &phase) { return phase.first == name; });
+        if (it != phases.end()) {
+            it->second += time;
+        } else {
+            phases.emplace_back(name.str(), time);
+        }
+    }
+
+    times compilation_stats::phase_time(string_ref name) const {
+        auto it = llvm::find_if(phases, [&] (const auto &phase) { return phase.first == name; });
+        return it != phases.end() ? it->second : times{};
+    }
+
+    void compilation_stats::add_counter(string_ref name, std::uint64_t value) {
+        auto it = llvm::find_if(counters, [&] (const auto &counter) { return counter.first == name; });
+        if (it != counters.end()) {
+            it->second += value;
+        } else {
+            counters.emplace_back(name.str(), value);
+        }
+    }
+
+    compilation_stats::pass_record &compilation_stats::record(const mlir::Pass *pass, operation op) {
+        auto key = std::make_pair(pass->getArgument().str(), op->getName().getStringRef().str());
+        auto [it, inserted] = pass_index.try_emplace(key, passes.size());
+        if (inserted) {
+            passes.push_back({ .name = key.first, .anchor = key.second });
+        }
+
+        return passes[it->second];
+    }
+
+    static void count_ops(operation root, compilation_stats::op_counts &counts) {
+        root->walk([&] (operation op) {
+            ++counts[op->getName().getDialectNamespace()];
+        });
+    }
+
+    static void accumulate(
+        compilation_stats::op_counts &into, const compilation_stats::op_counts &from
+    ) {
+        for (const auto &entry : from) {
+            into[entry.getKey()] += entry.getValue();
+        }
+    }
+
+    struct stats_instrumentation : mlir::PassInstrumentation
+    {
+        explicit stats_instrumentation(compilation_stats &stats) : stats(stats) {}
+
+        // Adaptors that run nested pass pipelines have no argument, their time
+        // is already covered by the nested passes.
+        static bool is_recorded(mlir::Pass *pass) { return !pass->getArgument().empty(); }
+
+        void runBeforePass(mlir::Pass *pass, operation op) override {
+            if (!is_recorded(pass)) {
+                return;
+            }
+
+            compilation_stats::op_counts counts;
+            count_ops(op, counts);
+
+            std::scoped_lock lock(stats.passes_mutex);
+            accumulate(stats.record(pass, op).ops_before, counts);
+            running[{ pass, op }] = times::now();
+        }
+
+        void runAfterPass(mlir::Pass *pass, operation op) override { finish(pass, op); }
+
+        void runAfterPassFailed(mlir::Pass *pass, operation op) override { finish(pass, op); }
+
+        void finish(mlir::Pass *pass, operation op) {
+            if (!is_recorded(pass)) {
+                return;
+            }
+
+            auto end = times::now();
+
+            compilation_stats::op_counts counts;
+            count_ops(op, counts);
+
+            std::scoped_lock lock(stats.passes_mutex);
+            auto &record = stats.record(pass, op);
+
+            auto it = running.find({ pass, op });
+            VAST_ASSERT(it != running.end());
+            end -= it->second;
+            running.erase(it);
+
+            record.runs++;
+            record.time += end;
+            accumulate(record.ops_after, counts);
+        }
+
+        compilation_stats &stats;
+        llvm::DenseMap< std::pair< mlir::Pass *, operation >, times > running;
+    };
+
+    void compilation_stats::instrument(mlir::PassManager &pm) {
+        pm.addInstrumentation(std::make_unique< stats_instrumentation >(*this));
+    }
+
+    static void write_times(llvm::json::OStream &json, const times &time) {
+        json.attribute("wall", time.wall);
+        json.attribute("cpu", time.cpu);
+    }
+
+    static void write_op_counts(
+        llvm::json::OStream &json, string_ref name, const compilation_stats::op_counts &counts
+    ) {
+        // sort dialects to get stable output
+        std::vector< string_ref > dialects;
+        for (const auto &entry : counts) {
+            dialects.push_back(entry.getKey());
+        }
+        llvm::sort(dialects);
+
+        json.attributeObject(name, [&] {
+            for (auto dialect : dialects) {
+                json.attribute(dialect, counts.lookup(dialect));
+            }
+        });
+    }
+
+    void compilation_stats::write(llvm::raw_ostream &os) const {
+        llvm::json::OStream json(os, 2);
+        json.object([&] {
+            json.attributeArray("phases", [&] {
+                for (const auto &[name, time] : phases) {
+                    json.object([&] {
+                        json.attribute("name", name);
+                        write_times(json, time);
+                    });
+                }
+            });
+
+            json.attributeObject("counters", [&] {
+                for (const auto &[name, value] : counters) {
+                    json.attribute(name, value);
+                }
+            });
+
+            json.attributeArray("passes", [&] {
+                for (const auto &pass : passes) {
+                    json.object([&] {
+                        json.attribute("name", pass.name);
+                        json.attribute("anchor", pass.anchor);
+                        json.attribute("runs", pass.runs);
+                        write_times(json, pass.time);
+                        write_op_counts(json, "ops_before", pass.ops_before);
+                        write_op_counts(json, "ops_after", pass.ops_after);
+                    });
+                }
+            });
+
+            if (auto rss = peak_rss()) {
+                json.attribute("peak_rss", *rss);
+            }
+        });
+        os << "\n";
+    }
+
+    logical_result compilation_stats::write(string_ref path) const {
+        std::error_code ec;
+        llvm::raw_fd_ostream os(path, ec, llvm::sys::fs::OF_Text);
+        if (ec) {
+            VAST_ERROR("cannot write stats to {0}: {1}", path, ec.message());
+            return mlir::failure();
+        }
+
+        write(os);
+        return mlir::success();
+    }
+
+    std::optional< std::uint64_t > peak_rss() {
+    #if defined(__unix__) || defined(__APPLE__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        #if defined(__APPLE__)
+            return std::uint64_t(usage.ru_maxrss); // bytes
+        #else
+            return std::uint64_t(usage.ru_maxrss) * 1024; // kilobytes
+        #endif
+        }
+    #endif
+        return std::nullopt;
+    }
+
+} // namespace vast::cc
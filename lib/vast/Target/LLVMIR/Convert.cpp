@@ -13,9 +13,14 @@ VAST_RELAX_WARNINGS
 #include <mlir/Target/LLVMIR/Dialect/All.h>
 #include <mlir/Target/LLVMIR/LLVMTranslationInterface.h>
 #include <mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h>
+#include <mlir/Target/LLVMIR/ModuleTranslation.h>
 
 #include <mlir/Pass/PassManager.h>
 
+#include <llvm/IR/Function.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Metadata.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/LLVMContext.h>
 
@@ -24,6 +29,7 @@ VAST_UNRELAX_WARNINGS
 
 #include "vast/Dialect/HighLevel/HighLevelDialect.hpp"
 #include "vast/Dialect/HighLevel/HighLevelOps.hpp"
+#include "vast/Dialect/LowLevel/LowLevelDialect.hpp"
 
 #include "vast/Conversion/Passes.hpp"
 #include "vast/Dialect/HighLevel/Passes.hpp"
@@ -49,6 +55,89 @@ namespace vast::target::llvmir
         }
     };
 
+    // Translates hints of the low-level dialect left on LLVM operations, that
+    // the LLVM dialect has no counterpart for.
+    class LowLevelToLLVMIR : public mlir::LLVMTranslationDialectInterface
+    {
+      public:
+        using Base = mlir::LLVMTranslationDialectInterface;
+        using Base::Base;
+
+        mlir::LogicalResult amendOperation(
+            mlir::Operation *op, mlir::NamedAttribute attr,
+            mlir::LLVM::ModuleTranslation &state
+        ) const final {
+            auto name = attr.getName().getValue();
+            if (name == ll::LowLevelDialect::getUnpredictableAttrName()) {
+                if (auto inst = state.lookupBranch(op)) {
+                    auto &ctx = inst->getContext();
+                    inst->setMetadata(llvm::LLVMContext::MD_unpredictable, llvm::MDNode::get(ctx, {}));
+                }
+            }
+
+            if (name == ll::LowLevelDialect::getUnrollEnableAttrName()) {
+                if (auto inst = state.lookupBranch(op)) {
+                    enable_unroll(inst);
+                }
+            }
+
+            return mlir::success();
+        }
+
+      private:
+        // Extends the `llvm.loop` metadata of a latch by `llvm.loop.unroll.enable`.
+        // All latches of a loop share the loop identifier, therefore the one
+        // already extended for another latch of the function is reused.
+        static void enable_unroll(llvm::Instruction *latch) {
+            auto &ctx = latch->getContext();
+
+            llvm::SmallVector< llvm::Metadata * > properties;
+            if (auto loop = latch->getMetadata(llvm::LLVMContext::MD_loop)) {
+                for (const auto &property : llvm::drop_begin(loop->operands())) {
+                    properties.push_back(property.get());
+                }
+            }
+            properties.push_back(llvm::MDNode::get(
+                ctx, llvm::MDString::get(ctx, "llvm.loop.unroll.enable")
+            ));
+
+            auto is_extended = [&] (llvm::MDNode *loop) {
+                if (loop->getNumOperands() != properties.size() + 1) {
+                    return false;
+                }
+
+                for (auto [property, expected] : llvm::zip(llvm::drop_begin(loop->operands()), properties)) {
+                    if (property.get() != expected) {
+                        return false;
+                    }
+                }
+
+                return true;
+            };
+
+            for (auto &inst : llvm::instructions(latch->getFunction())) {
+                auto loop = inst.getMetadata(llvm::LLVMContext::MD_loop);
+                if (loop && is_extended(loop)) {
+                    latch->setMetadata(llvm::LLVMContext::MD_loop, loop);
+                    return;
+                }
+            }
+
+            auto self = llvm::MDNode::getTemporary(ctx, {});
+            properties.insert(properties.begin(), self.get());
+
+            auto loop = llvm::MDNode::getDistinct(ctx, properties);
+            loop->replaceOperandWith(0, loop);
+            latch->setMetadata(llvm::LLVMContext::MD_loop, loop);
+        }
+    };
+
+    static void register_ll_to_llvm_ir(mlir::DialectRegistry &registry) {
+        registry.addExtension(+[] (mcontext_t *, ll::LowLevelDialect *dialect) {
+            dialect->addInterfaces< LowLevelToLLVMIR >();
+        });
+    }
+
     // TODO: move to translation passes that erase specific types from module
     void clean_up_data_layout(vast_module mlir_module) {
         // If the old data layout with high level types is left in the module,
@@ -88,6 +177,10 @@ namespace vast::target::llvmir
         mlir::registerBuiltinDialectTranslation(*mlir_module.getContext());
         mlir::registerLLVMDialectTranslation(*mlir_module.getContext());
 
+        mlir::DialectRegistry registry;
+        register_ll_to_llvm_ir(registry);
+        mlir_module.getContext()->appendDialectRegistry(registry);
+
         return mlir::translateModuleToLLVMIR(mlir_module, llvm_ctx);
     }
 
@@ -95,6 +188,7 @@ namespace vast::target::llvmir
     {
         registry.insert< hl::HighLevelDialect >();
         mlir::registerAllToLLVMIRTranslations(registry);
+        register_ll_to_llvm_ir(registry);
     }
 
     void register_vast_to_llvm_ir(mcontext_t &mctx)
@@ -2,6 +2,9 @@
 
 #include "vast/Tower/Tower.hpp"
 
+#include <algorithm>
+#include <optional>
+
 namespace vast::tw {
     auto default_loc_rewriter_t::insert(mlir::Operation *op) -> void {
         auto ctx = op->getContext();
@@ -20,3 +23,189 @@ namespace vast::tw {
         return mlir::OpaqueLoc::getUnderlyingLocation< mlir::Operation * >(ol);
     }
 } // namespace vast::tw
+
+namespace vast::tw {
+
+    namespace {
+        // Locations of the working copy refer to their source operations by
+        // an index, which stays valid even if a pass erases an operation and
+        // reuses its memory for a new one.
+        auto origin_tag_id() -> mlir::TypeID { return mlir::TypeID::get< snapshot_tower >(); }
+
+        auto tag_origin(loc_t loc, std::size_t index) -> loc_t {
+            auto ctx = loc.getContext();
+            auto tag = mlir::OpaqueLoc::get(index, origin_tag_id(), mlir::UnknownLoc::get(ctx));
+            return mlir::FusedLoc::get({ loc }, tag, ctx);
+        }
+
+        // Strips all origin tags from `loc`. Returns the untagged location
+        // and the index of the outermost tag, if any. Locations of operations
+        // merged by a pass may contain several tags.
+        auto untag_origin(loc_t loc) -> std::pair< loc_t, std::optional< std::size_t > > {
+            auto fused = mlir::dyn_cast< mlir::FusedLoc >(loc);
+            if (!fused) {
+                return { loc, std::nullopt };
+            }
+
+            std::optional< std::size_t > index;
+            llvm::SmallVector< loc_t, 2 > locs;
+            for (auto nested : fused.getLocations()) {
+                auto [untagged, nested_index] = untag_origin(nested);
+                locs.push_back(untagged);
+                index = index ? index : nested_index;
+            }
+
+            auto metadata = fused.getMetadata();
+            auto tag = llvm::dyn_cast_if_present< mlir::OpaqueLoc >(metadata);
+            if (tag && tag.getUnderlyingTypeID() == origin_tag_id()) {
+                index    = tag.getUnderlyingLocation();
+                metadata = {};
+            }
+
+            return { mlir::FusedLoc::get(locs, metadata, loc.getContext()), index };
+        }
+
+        auto top_level(operation op) -> operation {
+            while (!mlir::isa< vast_module >(op->getParentOp())) {
+                op = op->getParentOp();
+            }
+            return op;
+        }
+    } // namespace
+
+    snapshot_tower::snapshot_tower(mcontext_t &ctx, owning_module_ref mod) : _ctx(&ctx) {
+        snapshot_t root{ .storage = std::move(mod), .layout = {}, .provenance = {}, .parent = 0 };
+        for (auto &op : root.storage->getOps()) {
+            root.layout.push_back(&op);
+        }
+        _snapshots.push_back(std::move(root));
+    }
+
+    auto snapshot_tower::get(mcontext_t &ctx, owning_module_ref mod)
+        -> std::tuple< snapshot_tower, handle_t >
+    {
+        snapshot_tower t(ctx, std::move(mod));
+        return { std::move(t), handle_t{ .id = 0 } };
+    }
+
+    auto snapshot_tower::materialize(const snapshot_t &snapshot, mlir::IRMapping &mapping) const
+        -> owning_module_ref
+    {
+        auto mod = owning_module_ref(vast_module::create(snapshot.storage->getLoc()));
+        mod.get()->setAttrs(snapshot.storage.get()->getAttrDictionary());
+
+        auto bld = mlir::OpBuilder::atBlockEnd(mod->getBody());
+        for (auto op : snapshot.layout) {
+            bld.clone(*op, mapping);
+        }
+
+        return mod;
+    }
+
+    auto snapshot_tower::materialize(handle_t handle) const -> owning_module_ref {
+        mlir::IRMapping mapping;
+        return materialize(_snapshots[handle.id], mapping);
+    }
+
+    auto snapshot_tower::apply(handle_t handle, mlir::PassManager &pm) -> handle_t {
+        // The working copy is the only full copy of the module, it is reduced
+        // to the changed operations once the passes finish.
+        mlir::IRMapping mapping;
+        auto mod = materialize(_snapshots[handle.id], mapping);
+
+        std::vector< operation > sources;
+        sources.reserve(mapping.getOperationMap().size());
+        for (auto [from, to] : mapping.getOperationMap()) {
+            to->setLoc(tag_origin(to->getLoc(), sources.size()));
+            sources.push_back(from);
+        }
+
+        if (mlir::failed(pm.run(mod.get()))) {
+            VAST_FATAL("some pass in apply() failed");
+        }
+
+        snapshot_t next{ .storage = {}, .layout = {}, .provenance = {}, .parent = handle.id };
+        for (auto &op : llvm::make_early_inc_range(mod->getOps())) {
+            llvm::DenseMap< operation, operation > origins;
+            op.walk([&] (operation nested) {
+                auto [loc, index] = untag_origin(nested->getLoc());
+                nested->setLoc(loc);
+                if (index) {
+                    origins[nested] = sources[*index];
+                }
+            });
+
+            // Top-level operations equal to their source are shared.
+            auto from = origins.lookup(&op);
+            if (from && mlir::isa< vast_module >(from->getParentOp())
+                && mlir::OperationEquivalence::isEquivalentTo(
+                    from, &op, mlir::OperationEquivalence::Flags::None
+                )
+            ) {
+                next.layout.push_back(from);
+                op.erase();
+                continue;
+            }
+
+            next.layout.push_back(&op);
+            next.provenance.insert(origins.begin(), origins.end());
+        }
+
+        next.storage = std::move(mod);
+        _snapshots.push_back(std::move(next));
+        return top();
+    }
+
+    auto snapshot_tower::apply(handle_t handle, pass_ptr_t pass) -> handle_t {
+        mlir::PassManager pm(_ctx);
+        pm.addPass(std::move(pass));
+        return apply(handle, pm);
+    }
+
+    auto snapshot_tower::owns(const snapshot_t &snapshot, operation op) const -> bool {
+        return op->getParentOfType< vast_module >() == snapshot.storage.get();
+    }
+
+    auto snapshot_tower::owned_ops(handle_t handle) const -> std::size_t {
+        const auto &snapshot = _snapshots[handle.id];
+        return std::size_t(llvm::count_if(snapshot.layout, [&] (operation op) {
+            return owns(snapshot, op);
+        }));
+    }
+
+    auto snapshot_tower::prev(handle_t handle, operation op) const -> operation {
+        const auto &snapshot = _snapshots[handle.id];
+        if (auto from = snapshot.provenance.lookup(op)) {
+            return from;
+        }
+
+        // Shared operations are their own predecessors.
+        if (handle.id != 0 && !owns(snapshot, op)) {
+            return op;
+        }
+
+        return {};
+    }
+
+    auto snapshot_tower::own(handle_t handle, operation op) -> operation {
+        auto &snapshot = _snapshots[handle.id];
+        auto shared = top_level(op);
+        if (owns(snapshot, shared)) {
+            return op;
+        }
+
+        mlir::IRMapping mapping;
+        auto bld = mlir::OpBuilder::atBlockEnd(snapshot.storage->getBody());
+        auto copy = bld.clone(*shared, mapping);
+        std::replace(snapshot.layout.begin(), snapshot.layout.end(), shared, copy);
+
+        // The copies are derived from the operations they replace, same as
+        // the shared operations were.
+        for (auto [from, to] : mapping.getOperationMap()) {
+            snapshot.provenance[to] = from;
+        }
+
+        return mapping.lookup(op);
+    }
+
+} // namespace vast::tw
@@ -0,0 +1,102 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Util/Bytecode.hpp"
+
+VAST_RELAX_WARNINGS
+#include <mlir/Bytecode/BytecodeWriter.h>
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/IR/Diagnostics.h>
+#include <mlir/IR/FunctionInterfaces.h>
+#include <mlir/Parser/Parser.h>
+VAST_UNRELAX_WARNINGS
+
+namespace vast {
+
+    logical_result write_bytecode(
+        operation op, llvm::raw_ostream &os, std::optional< std::int64_t > version
+    ) {
+        mlir::BytecodeWriterConfig config("VAST");
+        if (version) {
+            if (*version < min_lazy_bytecode_version) {
+                return op->emitError("bytecode version ") << *version
+                    << " does not support lazy loading, expected at least "
+                    << min_lazy_bytecode_version;
+            }
+
+            config.setDesiredBytecodeVersion(*version);
+        }
+
+        return mlir::writeBytecodeToFile(op, os, config);
+    }
+
+    bool is_bytecode(const llvm::MemoryBuffer &buffer) {
+        return mlir::isBytecode(buffer.getMemBufferRef());
+    }
+
+    module_reader::module_reader(mcontext_t *mctx, bool lazy)
+        : mctx(mctx), lazy(lazy), source_mgr(std::make_shared< llvm::SourceMgr >())
+    {}
+
+    owning_module_ref module_reader::read(memory_buffer_ptr buffer) {
+        VAST_ASSERT(!reader && "module reader can read only a single module");
+
+        auto id = source_mgr->AddNewSourceBuffer(std::move(buffer), llvm::SMLoc());
+        auto ref = source_mgr->getMemoryBuffer(id)->getMemBufferRef();
+
+        if (mlir::isBytecode(ref)) {
+            return read_bytecode(ref);
+        }
+
+        return mlir::parseSourceFile< vast_module >(source_mgr, mlir::ParserConfig(mctx));
+    }
+
+    owning_module_ref module_reader::read_bytecode(llvm::MemoryBufferRef buffer) {
+        reader = std::make_unique< mlir::BytecodeReader >(
+            buffer, mlir::ParserConfig(mctx), lazy, source_mgr
+        );
+
+        // Function bodies are the bulk of the module, everything else is
+        // needed to resolve symbols and types and is loaded right away.
+        auto lazy_functions = [] (operation op) {
+            return mlir::isa< mlir::FunctionOpInterface >(op);
+        };
+
+        mlir::Block block;
+        if (mlir::failed(reader->readTopLevel(&block, lazy_functions))) {
+            return {};
+        }
+
+        if (!llvm::hasSingleElement(block) || !mlir::isa< vast_module >(block.front())) {
+            mlir::emitError(mlir::UnknownLoc::get(mctx), "expected a single top-level module");
+            return {};
+        }
+
+        auto mod = mlir::cast< vast_module >(block.front());
+        mod->remove();
+        return owning_module_ref(mod);
+    }
+
+    bool module_reader::is_materializable(operation op) {
+        return reader && reader->isMaterializable(op);
+    }
+
+    logical_result module_reader::materialize(operation op) {
+        auto result = mlir::success();
+        op->walk< mlir::WalkOrder::PreOrder >([&] (operation nested) {
+            if (is_materializable(nested) && mlir::failed(reader->materialize(nested))) {
+                result = mlir::failure();
+            }
+        });
+
+        return result;
+    }
+
+    logical_result module_reader::materialize_all() {
+        if (!reader) {
+            return mlir::success();
+        }
+
+        return reader->finalize();
+    }
+
+} // namespace vast
@@ -6,12 +6,12 @@
 namespace vast {
 
     void pipeline_t::addPass(std::unique_ptr<mlir::Pass> pass) {
-        auto id = pass->getTypeID();
-        if (seen.count(id)) {
+        auto key = scheduled_pass_t{ pass->getTypeID(), string_ref() };
+        if (seen.count(key)) {
             return;
         }
 
-        seen.insert(id);
+        seen.insert(key);
         VAST_PIPELINE_DEBUG("scheduling pass: {0}", pass->getName());
         base::addPass(std::move(pass));
     }
@@ -0,0 +1,180 @@
+// Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#include "vast/Util/Trace.hpp"
+
+VAST_RELAX_WARNINGS
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/Threading.h>
+#include <mlir/IR/SymbolTable.h>
+#include <mlir/Pass/PassInstrumentation.h>
+VAST_UNRELAX_WARNINGS
+
+namespace vast::trace {
+
+    void recorder::record(event &&ev) {
+        std::scoped_lock lock(mutex);
+        events.push_back(std::move(ev));
+    }
+
+    void recorder::write(llvm::raw_ostream &os) const {
+        std::scoped_lock lock(mutex);
+
+        auto micros = [] (clock::duration duration) {
+            return std::chrono::duration_cast< std::chrono::microseconds >(duration).count();
+        };
+
+        // Viewers expect spans of a thread ordered by start, enclosing spans first.
+        auto sorted = events;
+        llvm::sort(sorted, [] (const event &a, const event &b) {
+            return std::tuple(a.thread, a.start, b.duration)
+                 < std::tuple(b.thread, b.start, a.duration);
+        });
+
+        llvm::json::OStream json(os);
+        json.object([&] {
+            json.attribute("displayTimeUnit", "ms");
+            json.attributeArray("traceEvents", [&] {
+                llvm::DenseSet< std::uint64_t > threads;
+                for (const auto &ev : sorted) {
+                    threads.insert(ev.thread);
+                    json.object([&] {
+                        json.attribute("ph", "X");
+                        json.attribute("pid", 1);
+                        json.attribute("tid", int64_t(ev.thread));
+                        json.attribute("cat", ev.category);
+                        json.attribute("name", ev.name);
+                        json.attribute("ts", micros(ev.start - origin));
+                        json.attribute("dur", micros(ev.duration));
+                        if (!ev.detail.empty()) {
+                            json.attributeObject("args", [&] {
+                                json.attribute("detail", ev.detail);
+                            });
+                        }
+                    });
+                }
+
+                for (auto thread : threads) {
+                    json.object([&] {
+                        json.attribute("ph", "M");
+                        json.attribute("pid", 1);
+                        json.attribute("tid", int64_t(thread));
+                        json.attribute("name", "thread_name");
+                        json.attributeObject("args", [&] {
+                            json.attribute("name", "thread " + std::to_string(thread));
+                        });
+                    });
+                }
+            });
+        });
+        os << "\n";
+    }
+
+    logical_result recorder::write(string_ref path) const {
+        std::error_code ec;
+        llvm::raw_fd_ostream os(path, ec, llvm::sys::fs::OF_Text);
+        if (ec) {
+            VAST_ERROR("cannot write trace to {0}: {1}", path, ec.message());
+            return mlir::failure();
+        }
+
+        write(os);
+        return mlir::success();
+    }
+
+    scope::scope(recorder *rec, string_ref category, string_ref name)
+        : rec(rec)
+    {
+        if (rec) {
+            ev.category = category.str();
+            ev.name     = name.str();
+            ev.thread   = llvm::get_threadid();
+            ev.start    = clock::now();
+        }
+    }
+
+    scope::scope(recorder *rec, string_ref category, string_ref name, detail_builder detail)
+        : scope(rec, category, name)
+    {
+        if (rec) {
+            ev.detail = detail();
+        }
+    }
+
+    scope::~scope() {
+        if (rec) {
+            ev.duration = clock::now() - ev.start;
+            rec->record(std::move(ev));
+        }
+    }
+
+    //
+    // pass instrumentation
+    //
+    struct trace_instrumentation : mlir::PassInstrumentation
+    {
+        explicit trace_instrumentation(recorder &rec) : rec(rec) {}
+
+        static std::string pass_name(mlir::Pass *pass) {
+            // adaptors running nested pipelines have no argument
+            auto arg = pass->getArgument();
+            return arg.empty() ? pass->getName().str() : arg.str();
+        }
+
+        static std::string anchor_name(operation op) {
+            auto name = op->getName().getStringRef().str();
+            if (auto sym = op->getAttrOfType< mlir::StringAttr >(
+                mlir::SymbolTable::getSymbolAttrName()
+            )) {
+                name += " @" + sym.str();
+            }
+            return name;
+        }
+
+        void runBeforePass(mlir::Pass *pass, operation op) override {
+            event ev{
+                .category = "pass",
+                .name     = pass_name(pass),
+                .detail   = anchor_name(op),
+                .start    = clock::now(),
+                .duration = {},
+                .thread   = llvm::get_threadid()
+            };
+
+            std::scoped_lock lock(mutex);
+            running[{ pass, op }] = std::move(ev);
+        }
+
+        void runAfterPass(mlir::Pass *pass, operation op) override { finish(pass, op); }
+
+        void runAfterPassFailed(mlir::Pass *pass, operation op) override { finish(pass, op); }
+
+        void finish(mlir::Pass *pass, operation op) {
+            auto end = clock::now();
+
+            event ev;
+            {
+                std::scoped_lock lock(mutex);
+                auto it = running.find({ pass, op });
+                VAST_ASSERT(it != running.end());
+                ev = std::move(it->second);
+                running.erase(it);
+            }
+
+            ev.duration = end - ev.start;
+            rec.record(std::move(ev));
+        }
+
+        recorder &rec;
+
+        std::mutex mutex;
+        llvm::DenseMap< std::pair< mlir::Pass *, operation >, event > running;
+    };
+
+    void recorder::instrument(mlir::PassManager &pm) {
+        pm.addInstrumentation(std::make_unique< trace_instrumentation >(*this));
+    }
+
+} // namespace vast::trace
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2024-present, Trail of Bits, Inc.
+
+#
+# Measures per-invocation startup overhead of vast-front, i.e., wall time of
+# compiling a trivial translation unit, which is dominated by context and
+# dialect initialization. Useful to compare builds when running vast-front
+# over many small files:
+#
+#   ./scripts/bench-startup.py builds/default/tools/vast-front/vast-front
+#   ./scripts/bench-startup.py old/vast-front new/vast-front --runs 100
+#
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+source = """
+struct point { int x, y; };
+
+int add(struct point p) { return p.x + p.y; }
+
+int main(void) {
+    struct point p = { 1, 2 };
+    return add(p);
+}
+"""
+
+
+def measure(binary: str, args: list, runs: int) -> list:
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "startup.c")
+        with open(path, "w") as src:
+            src.write(source)
+
+        cmd = [binary] + args + [path, "-o", os.devnull]
+
+        # warm up file system caches
+        subprocess.run(cmd, check=True)
+
+        times = []
+        for _ in range(runs):
+            start = time.perf_counter()
+            subprocess.run(cmd, check=True)
+            times.append(time.perf_counter() - start)
+        return times
+
+
+def report(binary: str, times: list):
+    ms = [t * 1000 for t in times]
+    print(f"{binary}")
+    print(f"  runs:   {len(ms)}")
+    print(f"  min:    {min(ms):8.2f} ms")
+    print(f"  median: {statistics.median(ms):8.2f} ms")
+    print(f"  mean:   {statistics.mean(ms):8.2f} ms")
+    if len(ms) > 1:
+        print(f"  stdev:  {statistics.stdev(ms):8.2f} ms")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="vast-front startup benchmark")
+    parser.add_argument("binaries", nargs="+", help="vast-front binaries to compare")
+    parser.add_argument("--runs", type=int, default=50, help="number of measured runs")
+    parser.add_argument("--emit", default="hl", help="value of -vast-emit-mlir")
+    opts = parser.parse_args()
+
+    for binary in opts.binaries:
+        report(binary, measure(binary, [f"-vast-emit-mlir={opts.emit}"], opts.runs))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,24 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl -vast-emit-mlir-bytecode %s -o %t.mlirbc
+// RUN: %vast-query --show-symbols=functions %t.mlirbc | %file-check %s -check-prefix=FN
+// RUN: %vast-query --symbol-users=a --scope=foo %t.mlirbc | %file-check %s -check-prefix=FOO
+// RUN: %vast-opt %t.mlirbc | %file-check %s -check-prefix=TEXT
+
+// RUN: %vast-cc1 -vast-emit-mlir=hl -vast-emit-mlir-bytecode=2 %s -o %t.v2.mlirbc
+// RUN: %vast-query --show-symbols=functions %t.v2.mlirbc | %file-check %s -check-prefix=FN
+
+// FN: func : foo
+// FN: func : main
+
+// TEXT: hl.func @foo
+// TEXT: hl.func @main
+
+// FOO: hl.ref %0
+int foo() {
+    int a;
+    return a;
+}
+
+int main() {
+    int a = 1;
+    return foo() + a;
+}
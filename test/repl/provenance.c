@@ -0,0 +1,9 @@
+// RUN: printf "load %s\n raise vast-hl-to-ll-cf\n show provenance\n exit" | %vast-repl | %file-check %s
+// REQUIRES: repl
+
+// CHECK-DAG: hl.func <- hl.func
+// CHECK-DAG: ll.return <- hl.return
+
+int ext(int);
+
+int main(void) { return ext(0); }
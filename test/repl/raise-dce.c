@@ -0,0 +1,16 @@
+// RUN: printf "load %s\n raise vast-hl-dce\n show module\n exit" | %vast-repl | %file-check %s
+// RUN: printf "load %s\n raise vast-hl-dce,vast-hl-to-ll-cf\n show snapshots\n exit" | %vast-repl | %file-check %s --check-prefix=STAGES
+// REQUIRES: repl
+
+// CHECK: hl.return
+// CHECK-NOT: hl.const #core.integer<1>
+// CHECK: }
+
+// Each pass of the pipeline makes a single stage.
+// STAGES: snapshot 2 (parent 1)
+// STAGES-NOT: snapshot 3
+
+int main(void) {
+    return 0;
+    return 1;
+}
@@ -0,0 +1,17 @@
+// RUN: printf "load %s\n raise vast-hl-to-ll-cf\n show snapshots\n exit" | %vast-repl | %file-check %s
+// RUN: printf "load %s\n raise vast-hl-to-ll-cf\n meta add ext 7\n show snapshots\n exit" | %vast-repl | %file-check %s --check-prefix=META
+// REQUIRES: repl
+
+// The declaration is not changed by the pass, it is shared with the loaded
+// module, only the lowered function is owned by the new snapshot.
+
+// CHECK: snapshot 0 (parent 0): [[OPS:[0-9]+]] ops, [[OPS]] owned
+// CHECK: snapshot 1 (parent 0): [[OPS]] ops, 1 owned
+
+// Annotated declaration is copied into the snapshot.
+
+// META: snapshot 1 (parent 0): {{[0-9]+}} ops, 2 owned
+
+int ext(int);
+
+int main(void) { return ext(0); }
@@ -0,0 +1,12 @@
+// RUN: rm -rf %t && mkdir -p %t && cp %s %t/batch.c
+// RUN: echo '[' \
+// RUN:   '{ "directory": "%t", "command": "cc -DNAME=foo -c batch.c -o foo.o", "file": "batch.c" },' \
+// RUN:   '{ "directory": "%t", "command": "cc -DNAME=bar -c batch.c -o bar.o", "file": "batch.c" }' \
+// RUN: ']' > %t/compile_commands.json
+// RUN: %vast-front -vast-batch=%t/compile_commands.json -vast-batch-threads=2 -vast-emit-mlir=hl
+// RUN: %file-check %s --input-file=%t/foo.mlir -check-prefix=FOO
+// RUN: %file-check %s --input-file=%t/bar.mlir -check-prefix=BAR
+
+// FOO: hl.func @foo
+// BAR: hl.func @bar
+int NAME(int x) { return x + 1; }
@@ -0,0 +1,42 @@
+// RUN: %vast-front -vast-emit-mlir=llvm -o - %s | %file-check %s
+// RUN: %vast-front -vast-emit-mlir=llvm -vast-disable-speculation -o - %s | %file-check %s --check-prefix=DISABLED
+
+// DISABLED-LABEL: llvm.func @in_range
+// DISABLED: llvm.cond_br
+
+// CHECK-LABEL: llvm.func @in_range
+// CHECK-NOT: llvm.cond_br
+// CHECK: [[FALSE:%[0-9]+]] = llvm.mlir.constant(false) : i1
+// CHECK: llvm.select {{%[0-9]+}}, {{%[0-9]+}}, [[FALSE]] : i1, i1
+int in_range(int x, int lo, int hi) { return x >= lo && x < hi; }
+
+// CHECK-LABEL: llvm.func @either
+// CHECK-NOT: llvm.cond_br
+// CHECK: [[TRUE:%[0-9]+]] = llvm.mlir.constant(true) : i1
+// CHECK: llvm.select {{%[0-9]+}}, [[TRUE]], {{%[0-9]+}} : i1, i1
+int either(int a, int b) { return a || b; }
+
+// The shift is poison for `n >= 32`, which must not leak into the result.
+
+// CHECK-LABEL: llvm.func @shifted
+// CHECK-NOT: llvm.cond_br
+// CHECK: llvm.shl
+// CHECK-NOT: llvm.and
+// CHECK: llvm.select {{%[0-9]+}}, {{%[0-9]+}}, {{%[0-9]+}} : i1, i1
+// CHECK: llvm.return
+int shifted(int x, int n) { return n < 32 && (x << n); }
+
+// CHECK-LABEL: llvm.func @max
+// CHECK-NOT: llvm.cond_br
+// CHECK: llvm.select
+int max(int a, int b) { return a > b ? a : b; }
+
+// Loads through pointers and divisions may trap.
+
+// CHECK-LABEL: llvm.func @deref
+// CHECK: llvm.cond_br
+int deref(int n, int *p) { return n && *p; }
+
+// CHECK-LABEL: llvm.func @divides
+// CHECK: llvm.cond_br
+int divides(int a, int b) { return b && a % b == 0; }
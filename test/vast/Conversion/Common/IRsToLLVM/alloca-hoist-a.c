@@ -0,0 +1,14 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %vast-opt-irs-to-llvm | %file-check %s
+
+// CHECK: llvm.func @loop
+void loop(int n)
+{
+    // CHECK: llvm.alloca {{.*}} x i32 {alignment = 4 : i64}
+    // CHECK: llvm.alloca {{.*}} x i32 {alignment = 4 : i64}
+    // CHECK: llvm.alloca {{.*}} x f64 {alignment = 8 : i64}
+    // CHECK-NOT: llvm.alloca
+    // CHECK: llvm.return
+    for (int i = 0; i < n; ++i) {
+        double d = i;
+    }
+}
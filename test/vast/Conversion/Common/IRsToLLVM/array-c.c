@@ -0,0 +1,21 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %vast-opt-irs-to-llvm | %file-check %s
+
+// CHECK: llvm.mlir.global internal constant @table(dense<[0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225]> : tensor<16xi32>)
+unsigned int table[16] = {
+    0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225
+};
+
+// CHECK: llvm.mlir.global internal constant @small(dense<[1, 2, 0, 0]> : tensor<4xi32>)
+int small[4] = { 1, 2 };
+
+// CHECK: llvm.mlir.global internal constant @scalar(5 : i32)
+int scalar = 5;
+
+// CHECK: llvm.func @fn
+int fn()
+{
+    // CHECK: llvm.mlir.constant(dense<[1, 2, 3]> : tensor<3xi32>) : !llvm.array<3 x i32>
+    // CHECK-NOT: llvm.insertvalue
+    int arr[3] = { 1, 2, 3 };
+    return arr[0];
+}
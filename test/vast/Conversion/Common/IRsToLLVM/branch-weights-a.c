@@ -0,0 +1,31 @@
+// RUN: %vast-front -vast-emit-llvm -o - %s | %file-check %s
+
+void report(int code);
+
+// CHECK-LABEL: define {{.*}} @expect
+void expect(int x) {
+    // CHECK: br i1 {{%.*}}, label {{%.*}}, label {{%.*}}, !prof [[UNLIKELY:![0-9]+]]
+    if (__builtin_expect(x < 0, 0))
+        report(x);
+    // CHECK: br i1 {{%.*}}, label {{%.*}}, label {{%.*}}, !prof [[LIKELY:![0-9]+]]
+    while (__builtin_expect(x > 0, 1))
+        --x;
+}
+
+// CHECK-LABEL: define {{.*}} @probability
+void probability(int x) {
+    // CHECK: br i1 {{%.*}}, label {{%.*}}, label {{%.*}}, !prof [[PROB:![0-9]+]]
+    if (__builtin_expect_with_probability(x, 1, 0.75))
+        report(x);
+}
+
+// CHECK-LABEL: define {{.*}} @unpredictable
+void unpredictable(int x, int y) {
+    // CHECK: br i1 {{%.*}}, label {{%.*}}, label {{%.*}}, !unpredictable
+    if (__builtin_unpredictable(x < y))
+        report(x);
+}
+
+// CHECK-DAG: [[UNLIKELY]] = !{!"branch_weights", i32 1, i32 2000}
+// CHECK-DAG: [[LIKELY]] = !{!"branch_weights", i32 2000, i32 1}
+// CHECK-DAG: [[PROB]] = !{!"branch_weights", i32 1610612735, i32 536870912}
@@ -0,0 +1,27 @@
+// RUN: %vast-front -vast-emit-mlir=llvm -o - %s | %file-check %s
+
+// CHECK: llvm.func @copy({{%[a-z0-9]+}}: {{.*}} {llvm.noalias}, {{%[a-z0-9]+}}: {{.*}} {llvm.noalias, llvm.readonly}, {{%[a-z0-9]+}}: i32)
+void copy(int *restrict dst, const int *restrict src, int n) {
+    for (int i = 0; i < n; ++i)
+        dst[i] = src[i];
+}
+
+// CHECK: llvm.func @first({{%[a-z0-9]+}}: {{.*}} {llvm.nonnull}, {{%[a-z0-9]+}}: !llvm.ptr<i32>)
+__attribute__((nonnull(1))) int first(int *p, int *q) { return *p + (q ? *q : 0); }
+
+// CHECK: llvm.func @sum({{%[a-z0-9]+}}: {{.*}} {llvm.dereferenceable = 16 : i64, llvm.nonnull})
+int sum(int a[static 4]) { return a[0] + a[1] + a[2] + a[3]; }
+
+// CHECK: llvm.func @alloc(i64) -> (!llvm.ptr<i8> {llvm.noalias, llvm.nonnull})
+__attribute__((malloc, returns_nonnull)) void *alloc(unsigned long size);
+
+// CHECK: llvm.func @square{{.*}}memory = #llvm.memory_effects<other = none, argMem = none, inaccessibleMem = none>
+__attribute__((const)) int square(int x) { return x * x; }
+
+// CHECK: llvm.func @peek{{.*}}memory = #llvm.memory_effects<other = read, argMem = read, inaccessibleMem = read>
+__attribute__((pure)) int peek(const int *p) { return *p; }
+
+int use(int *p) {
+    int *q = alloc(4);
+    return first(p, q) + square(*p) + peek(p);
+}
@@ -0,0 +1,40 @@
+// RUN: %vast-front -vast-emit-mlir=llvm -o - %s | %file-check %s
+// RUN: %vast-front -vast-emit-mlir=llvm -vast-disable-fn-attrs -o - %s | %file-check %s --check-prefix=DISABLED
+
+// Every function of a C module is `nounwind`, `norecurse` is inferred from
+// the call graph.
+
+// DISABLED: llvm.func {{.*}}@leaf{{.*}}passthrough = ["noinline"]
+// DISABLED-NOT: nounwind
+
+// CHECK: llvm.func {{.*}}@leaf{{.*}}passthrough = ["noinline", "nounwind", "norecurse"]
+__attribute__((noinline)) int leaf(int x) { return x + 1; }
+
+// CHECK: llvm.func {{.*}}@hint{{.*}}passthrough = ["inlinehint", "nounwind", "norecurse"]
+static inline int hint(int x) { return leaf(x) * 2; }
+
+// CHECK: llvm.func {{.*}}@forced{{.*}}passthrough = ["alwaysinline", "nounwind", "norecurse"]
+static inline __attribute__((always_inline)) int forced(int x) { return x - 1; }
+
+// CHECK: llvm.func {{.*}}@report(i32){{.*}}passthrough = ["cold", "nounwind"]
+__attribute__((cold)) void report(int code);
+
+// CHECK: llvm.func {{.*}}@fast{{.*}}passthrough = ["hot", "nounwind"]
+__attribute__((hot)) int fast(int x) {
+    if (x < 0)
+        report(x);
+    return hint(x) + forced(x);
+}
+
+// CHECK: llvm.func {{.*}}@fact{{.*}}passthrough = ["nounwind"]
+int fact(int n) { return n > 1 ? n * fact(n - 1) : 1; }
+
+// CHECK-DAG: llvm.func {{.*}}@even{{.*}}passthrough = ["nounwind"]
+int odd(int n);
+int even(int n) { return n == 0 ? 1 : odd(n - 1); }
+
+// CHECK-DAG: llvm.func {{.*}}@odd{{.*}}passthrough = ["nounwind"]
+int odd(int n) { return n == 0 ? 0 : even(n - 1); }
+
+// CHECK: llvm.func {{.*}}@indirect{{.*}}passthrough = ["nounwind"]
+int indirect(int (*fn)(int), int x) { return fn(x); }
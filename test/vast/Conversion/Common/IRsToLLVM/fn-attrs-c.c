@@ -0,0 +1,17 @@
+// RUN: %vast-front -vast-emit-llvm -o - %s | %file-check %s
+
+// Facts about parameters stay with their arguments when the ABI splits or
+// spills other parameters.
+
+struct pair { long a; long b; };
+struct triple { long a; long b; long c; };
+
+// CHECK: define {{.*}} @split(ptr noalias {{%[0-9]+}}, i64 {{%[0-9]+}}, i64 {{%[0-9]+}}, ptr nonnull {{%[0-9]+}})
+__attribute__((nonnull(3))) long split(long *restrict p, struct pair s, long *q) {
+    return *p + s.a + s.b + *q;
+}
+
+// CHECK: define {{.*}} @spilled(ptr {{%[0-9]+}}, ptr noalias {{%[0-9]+}})
+long spilled(struct triple t, long *restrict p) {
+    return t.a + t.b + t.c + *p;
+}
@@ -0,0 +1,24 @@
+// RUN: %vast-front -vast-emit-mlir=llvm -o - %s | %file-check %s
+
+// In C++ `nounwind` holds only for functions that are known not to throw
+// or that call only such functions.
+
+void may_throw();
+void no_throw() noexcept;
+
+// CHECK: llvm.func {{.*}}@_Z4leafi{{.*}}passthrough = ["nounwind", "norecurse"]
+int leaf(int x) { return x + 1; }
+
+// CHECK: llvm.func {{.*}}@_Z6callerv{{.*}}passthrough = ["nounwind"]
+void caller() { no_throw(); }
+
+// CHECK-LABEL: llvm.func {{.*}}@_Z7throwerv
+// CHECK-NOT: passthrough
+void thrower() { may_throw(); }
+
+// CHECK-LABEL: llvm.func {{.*}}@main{{.*}}passthrough = ["norecurse"]
+int main() {
+    thrower();
+    caller();
+    return leaf(0);
+}
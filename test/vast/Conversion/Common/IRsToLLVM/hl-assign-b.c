@@ -4,11 +4,11 @@
 void count(int arg)
 {
     // CHECK: [[V0:%[0-9]+]] = llvm.mlir.constant(1 : index) : i64
-    // CHECK: [[V1:%[0-9]+]] = llvm.alloca [[V0]] x i32 : (i64) -> !llvm.ptr<i32>
+    // CHECK: [[V1:%[0-9]+]] = llvm.alloca [[V0]] x i32 {alignment = 4 : i64} : (i64) -> !llvm.ptr<i32>
+    // CHECK: [[V3:%[0-9]+]] = llvm.mlir.constant(1 : index) : i64
+    // CHECK: [[V4:%[0-9]+]] = llvm.alloca [[V3]] x i32 {alignment = 4 : i64} : (i64) -> !llvm.ptr<i32>
     // CHECK: [[V2:%[0-9]+]] = llvm.mlir.constant(15 : i32) : i32
     // CHECK: llvm.store [[V2]], [[V1]] : !llvm.ptr<i32>
-    // CHECK: [[V3:%[0-9]+]] = llvm.mlir.constant(1 : index) : i64
-    // CHECK: [[V4:%[0-9]+]] = llvm.alloca [[V3]] x i32 : (i64) -> !llvm.ptr<i32>
     // CHECK: [[V5:%[0-9]+]] = llvm.load [[V1]] : !llvm.ptr<i32>
     // CHECK: llvm.store [[V5]], [[V4]] : !llvm.ptr<i32>
 
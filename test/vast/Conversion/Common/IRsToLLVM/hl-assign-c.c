@@ -3,7 +3,7 @@
 void count()
 {
     // CHECK: [[V0:%[0-9]+]] = llvm.mlir.constant(1 : index) : i64
-    // CHECK: [[V1:%[0-9]+]] = llvm.alloca [[V0]] x i32 : (i64) -> !llvm.ptr<i32>
+    // CHECK: [[V1:%[0-9]+]] = llvm.alloca [[V0]] x i32 {alignment = 4 : i64} : (i64) -> !llvm.ptr<i32>
     // CHECK: [[V2:%[0-9]+]] = llvm.mlir.constant(1 : i32) : i32
     // CHECK: llvm.store [[V2]], [[V1]] : !llvm.ptr<i32>
     int x = 1;
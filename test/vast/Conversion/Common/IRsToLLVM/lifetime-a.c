@@ -0,0 +1,61 @@
+// RUN: %vast-front -vast-emit-mlir=llvm -o - %s | %file-check %s
+// RUN: %vast-front -vast-emit-mlir=llvm -vast-disable-lifetime-markers -o - %s | %file-check %s --check-prefix=DISABLED
+
+// DISABLED-NOT: llvm.intr.lifetime
+
+void sink(int *);
+
+// CHECK-LABEL: llvm.func @scopes
+void scopes(int c) {
+    int top = c;
+    // CHECK-NOT: llvm.intr.lifetime.start {{.*}}
+    // CHECK: llvm.intr.lifetime.start 4, [[A:%[0-9]+]]
+    // CHECK: llvm.call @sink([[A]])
+    // CHECK: llvm.intr.lifetime.end 4, [[A]]
+    if (c) {
+        int a = 1;
+        sink(&a);
+    }
+
+    // CHECK: llvm.intr.lifetime.start 16, [[B:%[0-9]+]]
+    // CHECK: llvm.intr.lifetime.end 16, [[B]]
+    {
+        long b[2] = { c, c };
+        sink((int *)b);
+    }
+
+    sink(&top);
+}
+
+// CHECK-LABEL: llvm.func @loop
+int loop(int n) {
+    // CHECK: llvm.intr.lifetime.start 4, [[I:%[0-9]+]]
+    // CHECK: llvm.intr.lifetime.start 4, [[X:%[0-9]+]]
+    // continue, return and the end of the body leave the scope of x
+    // CHECK-COUNT-3: llvm.intr.lifetime.end 4, [[X]]
+    for (int i = 0; i < n; ++i) {
+        int x = i;
+        if (x == 3)
+            continue;
+        if (x == 5)
+            return x;
+        sink(&x);
+    }
+    // CHECK: llvm.intr.lifetime.end 4, [[I]]
+    // CHECK: llvm.return
+    return 0;
+}
+
+// CHECK-LABEL: llvm.func @jumps
+int jumps(int n) {
+    // CHECK-NOT: llvm.intr.lifetime
+    // CHECK: llvm.return
+    {
+        int x = n;
+        if (x)
+            goto out;
+        sink(&x);
+    }
+out:
+    return n;
+}
@@ -0,0 +1,58 @@
+// RUN: %vast-front -vast-emit-llvm -o - %s | %file-check %s
+
+// CHECK-LABEL: define {{.*}} @unrolled
+void unrolled(int *a, int n) {
+    // CHECK: br label {{.*}}, !llvm.loop [[UNROLLED:![0-9]+]]
+    #pragma unroll 4
+    for (int i = 0; i < n; ++i) {
+        a[i] = i;
+    }
+}
+
+// CHECK-LABEL: define {{.*}} @continued
+void continued(int *a, int n) {
+    // CHECK: br label {{.*}}, !llvm.loop [[CONTINUED:![0-9]+]]
+    // CHECK: br label {{.*}}, !llvm.loop [[CONTINUED]]
+    #pragma unroll 4
+    while (n > 0) {
+        if (a[--n] < 0)
+            continue;
+        a[n] = 0;
+    }
+}
+
+// CHECK-LABEL: define {{.*}} @enabled
+void enabled(int *a, int n) {
+    // CHECK: br label {{.*}}, !llvm.loop [[ENABLED:![0-9]+]]
+    #pragma unroll
+    for (int i = 0; i < n; ++i) {
+        a[i] = i;
+    }
+}
+
+// CHECK-LABEL: define {{.*}} @vectorized
+void vectorized(int *a, int n) {
+    // CHECK: br label {{.*}}, !llvm.loop [[VECTORIZED:![0-9]+]]
+    #pragma clang loop vectorize_width(8) interleave_count(2) distribute(enable)
+    while (n > 0) {
+        a[--n] = 0;
+    }
+}
+
+// CHECK-LABEL: define {{.*}} @progress
+void progress(int n) {
+    // CHECK: br label {{.*}}, !llvm.loop [[PROGRESS:![0-9]+]]
+    while (n--) {}
+}
+
+// CHECK-DAG: [[MUSTPROGRESS:![0-9]+]] = !{!"llvm.loop.mustprogress"}
+// CHECK-DAG: [[UNROLLED]] = distinct !{[[UNROLLED]], {{.*}}}
+// CHECK-DAG: !{!"llvm.loop.unroll.count", i32 4}
+// CHECK-DAG: [[CONTINUED]] = distinct !{[[CONTINUED]], {{.*}}}
+// CHECK-DAG: [[ENABLED]] = distinct !{[[ENABLED]], {{.*}}}
+// CHECK-DAG: !{!"llvm.loop.unroll.enable"}
+// CHECK-DAG: [[VECTORIZED]] = distinct !{[[VECTORIZED]], {{.*}}}
+// CHECK-DAG: !{!"llvm.loop.vectorize.width", i32 8}
+// CHECK-DAG: !{!"llvm.loop.interleave.count", i32 2}
+// CHECK-DAG: !{!"llvm.loop.distribute.enable", i1 true}
+// CHECK-DAG: [[PROGRESS]] = distinct !{[[PROGRESS]], [[MUSTPROGRESS]]}
@@ -0,0 +1,15 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %vast-opt-irs-to-llvm | %file-check %s
+
+// CHECK: llvm.mlir.global internal constant @[[STR:vast.strlit.constant_[0-9A-F]+]]("fmt %d\00")
+// CHECK-NOT: llvm.mlir.global internal constant @vast.strlit.constant_{{.*}}("fmt %d\00")
+
+int printf(const char *, ...);
+
+// CHECK: llvm.func @fn
+void fn(int a)
+{
+    // CHECK: llvm.mlir.addressof @[[STR]]
+    printf("fmt %d", a);
+    // CHECK: llvm.mlir.addressof @[[STR]]
+    printf("fmt %d", a);
+}
@@ -0,0 +1,14 @@
+// RUN: %vast-front -vast-emit-llvm -o - %s | %file-check %s
+
+#define S16   "0123456789abcdef"
+#define S256  S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16
+#define S1K   S256 S256 S256 S256
+
+// CHECK: @[[STR:vast.strlit.constant_[0-9A-F]+]] = internal constant [1025 x i8] c"0123456789abcdef{{(0123456789abcdef)+}}\00"
+// CHECK-NOT: internal constant [1025 x i8]
+
+// CHECK-LABEL: define {{.*}} @large
+const char *large(int i) {
+    // CHECK: @[[STR]]
+    return i ? S1K : S1K;
+}
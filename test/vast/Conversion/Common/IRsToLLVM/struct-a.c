@@ -4,7 +4,7 @@ struct X { int x; };
 
 int main()
 {
-    // CHECK: {{.*}} = llvm.alloca {{.*}} x !llvm.struct<"X", (i32)> : (i64) -> !llvm.ptr<struct<"X", (i32)>>
+    // CHECK: {{.*}} = llvm.alloca {{.*}} x !llvm.struct<"X", (i32)> {alignment = 4 : i64} : (i64) -> !llvm.ptr<struct<"X", (i32)>>
     struct X x;
     return 0;
 }
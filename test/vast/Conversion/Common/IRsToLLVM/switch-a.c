@@ -0,0 +1,18 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %vast-opt-irs-to-llvm | %file-check %s
+
+// CHECK: llvm.func @fn
+int fn(int a)
+{
+    // CHECK: llvm.switch {{.*}} : i32, ^[[EXIT:bb[0-9]+]] [
+    // CHECK-NEXT: 0: ^[[C0:bb[0-9]+]],
+    // CHECK-NEXT: 1: ^[[C1:bb[0-9]+]],
+    // CHECK-NEXT: 2: ^[[C2:bb[0-9]+]]
+    // CHECK-NEXT: ]
+    switch (a) {
+        case 0: a = 1; break;
+        case 1: a = 2;
+        case 2: a += 3; break;
+    }
+    // CHECK: llvm.return
+    return a;
+}
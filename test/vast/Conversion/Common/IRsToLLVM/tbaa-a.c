@@ -0,0 +1,40 @@
+// RUN: %vast-front -vast-emit-llvm -o - %s | %file-check %s
+// RUN: %vast-front -vast-emit-llvm -vast-disable-tbaa -o - %s | %file-check %s --check-prefix=DISABLED
+// RUN: %vast-front -vast-emit-llvm -fno-strict-aliasing -o - %s | %file-check %s --check-prefix=DISABLED
+
+// DISABLED-NOT: !tbaa
+
+struct point { int x; float y; };
+
+union bits { int i; float f; };
+
+// CHECK-LABEL: define {{.*}} @set_y
+void set_y(struct point *p, float v) {
+    // CHECK: store float {{.*}}, !tbaa [[POINT_Y:![0-9]+]]
+    p->y = v;
+}
+
+// CHECK-LABEL: define {{.*}} @deref
+int deref(int *i, long *l) {
+    // CHECK: store i64 {{.*}}, !tbaa [[LONG:![0-9]+]]
+    *l = 0;
+    // CHECK: load i32, {{.*}}, !tbaa [[INT:![0-9]+]]
+    return *i;
+}
+
+// CHECK-LABEL: define {{.*}} @pun
+float pun(union bits *b) {
+    // CHECK: store i32 {{.*}}, !tbaa [[CHAR:![0-9]+]]
+    b->i = 1;
+    return b->f;
+}
+
+// CHECK-DAG: [[POINT_Y]] = !{[[POINT:![0-9]+]], [[FLOAT:![0-9]+]], i64 4}
+// CHECK-DAG: [[POINT]] = !{!"point", [[INT_TY:![0-9]+]], i64 0, [[FLOAT]], i64 4}
+// CHECK-DAG: [[INT]] = !{[[INT_TY]], [[INT_TY]], i64 0}
+// CHECK-DAG: [[INT_TY]] = !{!"int", [[CHAR_TY:![0-9]+]], i64 0}
+// CHECK-DAG: [[LONG]] = !{[[LONG_TY:![0-9]+]], [[LONG_TY]], i64 0}
+// CHECK-DAG: [[LONG_TY]] = !{!"long", [[CHAR_TY]], i64 0}
+// CHECK-DAG: [[CHAR]] = !{[[CHAR_TY]], [[CHAR_TY]], i64 0}
+// CHECK-DAG: [[CHAR_TY]] = !{!"omnipotent char", [[ROOT:![0-9]+]], i64 0}
+// CHECK-DAG: [[ROOT]] = !{!"VAST TBAA"}
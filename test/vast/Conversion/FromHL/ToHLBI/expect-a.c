@@ -0,0 +1,14 @@
+// RUN: %vast-front -vast-emit-mlir=hl -o - %s | %vast-opt --vast-hl-to-hl-builtin | %file-check %s
+
+int fn(int x, long y) {
+    // CHECK: hlbi.expect {{%.*}}, {{%.*}} : (!hl.long, !hl.long) -> !hl.long
+    if (__builtin_expect(x, 0))
+        return 0;
+    // CHECK: hlbi.expect_with_probability {{%.*}}, {{%.*}} probability {{%.*}} : (!hl.long, !hl.long, !hl.double) -> !hl.long
+    if (__builtin_expect_with_probability(y, 1, 0.9))
+        return 1;
+    // CHECK: hlbi.unpredictable {{%.*}} : (!hl.long) -> !hl.long
+    if (__builtin_unpredictable(x > y))
+        return 2;
+    return 3;
+}
@@ -0,0 +1,47 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %vast-opt --vast-hl-dce --vast-hl-lower-types --vast-hl-to-ll-cf | %file-check %s
+
+int fn(int a)
+{
+    // CHECK: ll.scope {
+    // CHECK:   ll.switch {{.*}}, ^bb4, dense<[1, 2, 3, 4]> : tensor<4xi32> [^bb1, ^bb2, ^bb2, ^bb3]
+    // CHECK: ^bb1:  // pred: ^bb0
+    // CHECK:   ll.return
+    // CHECK: ^bb2:  // 2 preds: ^bb0, ^bb0
+    // CHECK:   ll.br ^bb3
+    // CHECK: ^bb3:  // 2 preds: ^bb0, ^bb2
+    // CHECK:   ll.return
+    // CHECK: ^bb4:  // pred: ^bb0
+    // CHECK:   ll.scope_ret
+    // CHECK: }
+    switch (a) {
+        case 1: return 10;
+        case 2:
+        case 3: a += 1;
+        case 4: return a;
+        default: break;
+    }
+    return 0;
+}
+
+enum color { red, green = 4, blue };
+
+int colors(enum color c)
+{
+    // CHECK: ll.switch {{.*}}, ^bb{{[0-9]+}}, dense<[0, 5]> : tensor<2xi32>
+    switch (c) {
+        case red: return 1;
+        case blue: return 2;
+    }
+    return 0;
+}
+
+int ranges(int a)
+{
+    // CHECK: ll.switch {{.*}}, ^bb{{[0-9]+}}, dense<[1, 2, 3, 10]> : tensor<4xi32> {{\[}}[[RANGE:\^bb[0-9]+]], [[RANGE]], [[RANGE]], ^bb{{[0-9]+}}]
+    switch (a) {
+        case 1 ... 3: return 1;
+        case 10: return 2;
+        case 5 ... 4: return 3;
+    }
+    return 0;
+}
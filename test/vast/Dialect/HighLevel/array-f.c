@@ -0,0 +1,17 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %file-check %s
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o %t && %vast-opt %t | diff -B %t -
+
+// CHECK: hl.var "table" : !hl.lvalue<!hl.array<16, !hl.int< unsigned >>> = {
+// CHECK:   [[V1:%[0-9]+]] = hl.initlist {value = dense<[0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225]> : tensor<16xi32>} : () -> !hl.array<16, !hl.int< unsigned >>
+// CHECK:   hl.value.yield [[V1]] : !hl.array<16, !hl.int< unsigned >>
+unsigned int table[16] = {
+    0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225
+};
+
+// CHECK: hl.var "grid" : !hl.lvalue<!hl.array<4, !hl.array<4, !hl.short>>> = {
+// CHECK:   hl.initlist {value = dense<{{\[}}[1, 2, 0, 0], [3, 0, 0, 0], [0, 0, 0, 0], [0, 0, 0, 0]]> : tensor<4x4xi16>}
+short grid[4][4] = { { 1, 2 }, { 3 } };
+
+// CHECK: hl.var "small" : !hl.lvalue<!hl.array<4, !hl.int>> = {
+// CHECK:   hl.initlist {{%[0-9]+}}, {{%[0-9]+}} : (!hl.int, !hl.int) -> !hl.array<4, !hl.int>
+int small[4] = { 1, 2 };
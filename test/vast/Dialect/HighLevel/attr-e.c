@@ -0,0 +1,17 @@
+// RUN: %vast-front -vast-emit-mlir=hl -o - %s | %file-check %s
+// RUN: %vast-front -vast-emit-mlir=hl -o - %s > %t && %vast-opt %t | diff -B %t -
+
+// CHECK: hl.func @copy ({{.*}} {restrict = #hl.restrict}, {{.*}} {const = #hl.const, restrict = #hl.restrict}, {{%[a-z0-9]+}}: !hl.int)
+void copy(int *restrict dst, const int *restrict src, int n) {
+    for (int i = 0; i < n; ++i)
+        dst[i] = src[i];
+}
+
+// CHECK: hl.func @first ({{.*}} {nonnull = #hl.nonnull}, {{%[a-z0-9]+}}: !hl.ptr<!hl.int>)
+__attribute__((nonnull(1))) int first(int *p, int *q) { return *p + (q ? *q : 0); }
+
+// CHECK: hl.func @sum ({{.*}} {dereferenceable = #hl.dereferenceable<16>, nonnull = #hl.nonnull})
+int sum(int a[static 4]) { return a[0] + a[1] + a[2] + a[3]; }
+
+// CHECK: hl.func @alloc {{.*}} attributes {malloc = #hl.restrict, returns_nonnull = #hl.returns_nonnull}
+__attribute__((malloc, returns_nonnull)) void *alloc(unsigned long size);
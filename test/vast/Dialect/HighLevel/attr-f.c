@@ -0,0 +1,27 @@
+// RUN: %vast-front -vast-emit-mlir=hl -o - %s | %file-check %s
+// RUN: %vast-front -vast-emit-mlir=hl -o - %s > %t && %vast-opt %t | diff -B %t -
+
+// CHECK: hl.func @never {{.*}} attributes {noinline = #hl.noinline}
+__attribute__((noinline)) int never(int x) { return x + 1; }
+
+// CHECK: hl.func @always {{.*}} attributes {always_inline = #hl.always_inline}
+static inline __attribute__((always_inline)) int always(int x) { return x + 2; }
+
+// CHECK: hl.func @hint {{.*}} attributes {inline_hint = #hl.inline_hint}
+static inline int hint(int x) { return x + 3; }
+
+// CHECK: hl.func @unlikely {{.*}} attributes {cold = #hl.cold}
+__attribute__((cold)) void unlikely(void) {}
+
+// CHECK: hl.func @likely {{.*}} attributes {hot = #hl.hot}
+__attribute__((hot)) void likely(void) {}
+
+// CHECK: hl.func @safe {{.*}} attributes {nothrow = #hl.nothrow}
+__attribute__((nothrow)) void safe(void);
+
+int use(int x) {
+    unlikely();
+    likely();
+    safe();
+    return never(x) + always(x) + hint(x);
+}
@@ -25,15 +25,18 @@ int main() {
     case RED:
         puts("red");
         break;
+    // CHECK: } {hl.case_value = #core.integer<0> : {{.*}}}
     // CHECK: hl.case
     // CHECK:  hl.enumref "GREEN" : !hl.int
     case GREEN:
         puts("green");
         break;
+    // CHECK: } {hl.case_value = #core.integer<1> : {{.*}}}
     // CHECK: hl.case
     // CHECK:  hl.enumref "BLUE" : !hl.int
     case BLUE:
         puts("blue");
         break;
+    // CHECK: } {hl.case_value = #core.integer<2> : {{.*}}}
     }
 }
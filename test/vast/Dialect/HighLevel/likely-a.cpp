@@ -0,0 +1,33 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl -std=c++20 %s -o - | %file-check %s
+// RUN: %vast-cc1 -vast-emit-mlir=hl -std=c++20 %s -o %t && %vast-opt %t | diff -B %t -
+
+int branches(int x) {
+    // CHECK: hl.if
+    // CHECK: } {likely = #hl.likely}
+    if (x > 0) [[likely]] {
+        x = 1;
+    }
+
+    // CHECK: hl.if
+    // CHECK: } {unlikely = #hl.unlikely}
+    if (x < 0) {
+        x = 2;
+    } else [[likely]] {
+        x = 3;
+    }
+
+    // CHECK: hl.while
+    // CHECK: } {loop_hint = {{.*}}, unlikely = #hl.unlikely}
+    while (x < 10) [[unlikely]] {
+        ++x;
+    }
+
+    // CHECK: hl.for
+    // CHECK: incr
+    // CHECK: {likely = #hl.likely, loop_hint = {{.*}}} do
+    for (int i = 0; i < x; ++i) [[likely]] {
+        --x;
+    }
+
+    return x;
+}
@@ -0,0 +1,39 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %file-check %s
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o %t && %vast-opt %t | diff -B %t -
+
+void hints(int *a, int n) {
+    // CHECK: hl.for
+    // CHECK: incr
+    // CHECK: {loop_hint = #hl.loop_hint<vectorize = true, vectorize_width = 4 : i32, interleave_count = 2 : i32, mustprogress = true>} do
+    #pragma clang loop vectorize(enable) vectorize_width(4) interleave_count(2)
+    for (int i = 0; i < n; ++i) {
+        a[i] = i;
+    }
+
+    // CHECK: hl.while
+    // CHECK: } {loop_hint = #hl.loop_hint<unroll_count = 8 : i32, distribute = false, mustprogress = true>}
+    #pragma unroll 8
+    #pragma clang loop distribute(disable)
+    while (n > 0) {
+        --n;
+    }
+
+    // CHECK: hl.do
+    // CHECK: } {loop_hint = #hl.loop_hint<unroll = false>}
+    #pragma nounroll
+    do {
+        ++n;
+    } while (1);
+}
+
+void progress(int n) {
+    // CHECK: hl.while
+    // CHECK: } {loop_hint = #hl.loop_hint<mustprogress = true>}
+    while (n--) {}
+
+    // CHECK: hl.for
+    // CHECK: incr
+    // CHECK-NOT: loop_hint
+    // CHECK: } do
+    for (;;) {}
+}
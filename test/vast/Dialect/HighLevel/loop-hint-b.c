@@ -0,0 +1,17 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl -ffinite-loops %s -o - | %file-check %s --check-prefix=FINITE
+// RUN: %vast-cc1 -vast-emit-mlir=hl -fno-finite-loops %s -o - | %file-check %s --check-prefix=INFINITE
+
+void progress(int n) {
+    // FINITE: hl.while
+    // FINITE: } {loop_hint = #hl.loop_hint<mustprogress = true>}
+    // INFINITE: hl.while
+    // INFINITE-NOT: loop_hint
+    while (n--) {}
+
+    // FINITE: hl.for
+    // FINITE: incr
+    // FINITE: } {loop_hint = #hl.loop_hint<mustprogress = true>} do
+    // INFINITE: hl.for
+    // INFINITE-NOT: loop_hint
+    for (;;) {}
+}
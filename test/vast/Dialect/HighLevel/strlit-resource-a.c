@@ -0,0 +1,22 @@
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o - | %file-check %s
+// RUN: %vast-cc1 -vast-emit-mlir=hl %s -o %t && %vast-opt %t | diff -B %t -
+
+#define S16   "0123456789abcdef"
+#define S256  S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16 S16
+#define S1K   S256 S256 S256 S256
+
+// CHECK: hl.func @small
+const char *small(void) {
+    // CHECK: hl.const "short" : !hl.lvalue<!hl.array<6, !hl.char>>
+    return "short";
+}
+
+// CHECK: hl.func @large
+const char *large(int i) {
+    // CHECK: hl.const #core.strlit<dense_resource<[[BLOB:strlit[_0-9]*]]> : tensor<1025xi8>> : !hl.lvalue<!hl.array<1025, !hl.char>>
+    // CHECK: hl.const #core.strlit<dense_resource<[[BLOB]]> : tensor<1025xi8>> : !hl.lvalue<!hl.array<1025, !hl.char>>
+    return i ? S1K : S1K;
+}
+
+// CHECK: dialect_resources
+// CHECK: [[BLOB]]: "0x01000000303132
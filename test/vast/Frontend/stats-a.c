@@ -0,0 +1,32 @@
+// RUN: %vast-cc1 -vast-emit-mlir=llvm -vast-stats=%t.json %s -o %t.mlir
+// RUN: %file-check %s --input-file=%t.json
+// RUN: %file-check %s --input-file=%t.json --check-prefix=NESTED
+
+// CHECK: "phases": [
+// CHECK-DAG: "name": "parse"
+// CHECK-DAG: "name": "codegen"
+// CHECK-DAG: "name": "pipeline"
+// CHECK-DAG: "name": "emit-mlir"
+// CHECK: "counters": {
+// CHECK: "type_cache_hits": {{[0-9]+}}
+// CHECK: "type_cache_misses": {{[1-9][0-9]*}}
+// CHECK: "avoided_manglings": {{[0-9]+}}
+// CHECK: "passes": [
+// CHECK: "name": "vast-{{.*}}"
+// CHECK: "runs": {{[1-9][0-9]*}}
+// CHECK: "wall":
+// CHECK: "cpu":
+// CHECK: "ops_before": {
+// CHECK: "hl": {{[1-9][0-9]*}}
+// CHECK: "ops_after": {
+// CHECK: "peak_rss": {{[1-9][0-9]*}}
+
+// Clones of a pass nested on functions share a single record.
+// NESTED: "name": "vast-hl-to-ll-cf"
+// NESTED-NEXT: "anchor": "ll.func"
+// NESTED-NEXT: "runs": 2
+// NESTED-NOT: "name": "vast-hl-to-ll-cf"
+
+int add(int a, int b) { return a + b; }
+
+int main(void) { return add(1, 2); }
@@ -0,0 +1,14 @@
+// RUN: %vast-cc1 -vast-emit-mlir=llvm -vast-trace=%t.json %s -o %t.mlir
+// RUN: %file-check %s --input-file=%t.json
+
+// CHECK: "traceEvents":[
+// CHECK-DAG: "cat":"codegen","name":"Function","ts":{{[0-9]+}},"dur":{{[0-9]+}},"args":{"detail":"add"}
+// CHECK-DAG: "cat":"codegen","name":"Function","ts":{{[0-9]+}},"dur":{{[0-9]+}},"args":{"detail":"main"}
+// CHECK-DAG: "cat":"phase","name":"pipeline"
+// CHECK-DAG: "cat":"pass","name":"vast-{{[a-z-]+}}","ts":{{[0-9]+}},"dur":{{[0-9]+}},"args":{"detail":"builtin.module"}
+// CHECK-DAG: "cat":"phase","name":"emit-mlir"
+// CHECK-DAG: "ph":"M","pid":1,"tid":{{[0-9]+}},"name":"thread_name"
+
+int add(int a, int b) { return a + b; }
+
+int main(void) { return add(1, 2); }
@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2024, Trail of Bits, Inc.
+// All rights reserved.
+//
+// This source code is licensed in accordance with the terms specified in
+// the LICENSE file found in the root directory of this source tree.
+//
+
+//===----------------------------------------------------------------------===//
+//
+// Batch mode of vast-front compiles all translation units of a compilation
+// database inside a single process. Targets are initialized once and the
+// translation units are distributed among the threads of a thread pool. Each
+// translation unit gets its own MLIR context, built from a dialect registry
+// shared by the whole process, and produces its own output file.
+//
+//===----------------------------------------------------------------------===//
+
+#include "vast/Util/Warnings.hpp"
+
+VAST_RELAX_WARNINGS
+#include <clang/Basic/FileManager.h>
+#include <clang/Tooling/ArgumentsAdjusters.h>
+#include <clang/Tooling/JSONCompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Threading.h>
+#include <llvm/Support/VirtualFileSystem.h>
+VAST_UNRELAX_WARNINGS
+
+#include "vast/Config/config.h"
+#include "vast/Frontend/Action.hpp"
+#include "vast/Frontend/CompilerInstance.hpp"
+#include "vast/Frontend/Options.hpp"
+#include "vast/Frontend/Targets.hpp"
+
+#include <atomic>
+#include <mutex>
+
+namespace vast::cc {
+
+    frontend_action_ptr create_frontend_action(const vast_args &vargs);
+
+    using compile_command = clang::tooling::CompileCommand;
+
+    static unsigned get_batch_threads(const vast_args &vargs) {
+        unsigned threads = 0; // use all available hardware threads
+        if (auto value = vargs.get_option(opt::batch_threads)) {
+            if (value->getAsInteger(10, threads) || threads == 0) {
+                VAST_FATAL("invalid number of batch threads: {0}", value.value());
+            }
+        }
+
+        return threads;
+    }
+
+    static std::string get_output_path(const compile_command &cmd, string_ref suffix) {
+        llvm::SmallString< 256 > path(cmd.Output.empty() ? cmd.Filename : cmd.Output);
+        llvm::sys::fs::make_absolute(cmd.Directory, path);
+        llvm::sys::path::replace_extension(path, suffix);
+        return std::string(path.str());
+    }
+
+    //
+    // Runs vast frontend action on a compiler invocation built from a single
+    // compile command. The output file is overridden, so that it does not
+    // depend on the working directory of the process.
+    //
+    struct batch_tool_action : clang::tooling::ToolAction
+    {
+        batch_tool_action(frontend_action_ptr action, std::string output)
+            : action(std::move(action)), output(std::move(output))
+        {}
+
+        bool runInvocation(
+            std::shared_ptr< clang::CompilerInvocation > invocation,
+            clang::FileManager *files,
+            std::shared_ptr< clang::PCHContainerOperations > pch,
+            clang::DiagnosticConsumer *diags
+        ) override {
+            invocation->getFrontendOpts().OutputFile = output;
+
+            compiler_instance ci(std::move(pch));
+            ci.setInvocation(std::move(invocation));
+            ci.setFileManager(files);
+
+            if (ci.createDiagnostics(diags, /* ShouldOwnClient */ false); !ci.hasDiagnostics()) {
+                return false;
+            }
+
+            ci.createSourceManager(*files);
+
+            bool success = ci.ExecuteAction(*action);
+            files->clearStatCache();
+            return success;
+        }
+
+        frontend_action_ptr action;
+        std::string output;
+    };
+
+    struct batch_compiler
+    {
+        explicit batch_compiler(const vast_args &vargs)
+            : tu_vargs(vargs)
+        {
+            // Each translation unit runs its pipeline on a single thread,
+            // parallelism comes from compiling several units at once.
+            tu_vargs.push_back("-vast-disable-multithreading");
+        }
+
+        static clang::tooling::ArgumentsAdjuster make_adjuster() {
+            using namespace clang::tooling;
+
+            auto adjuster = combineAdjusters(
+                getClangStripOutputAdjuster(), getClangStripDependencyFileAdjuster()
+            );
+
+            return combineAdjusters(adjuster, getInsertArgumentAdjuster(
+                "-resource-dir=" CLANG_RESOURCE_DIR, ArgumentInsertPosition::END
+            ));
+        }
+
+        bool compile(const compile_command &cmd) const {
+            // The action is validated by `batch` before any unit is scheduled.
+            auto action = create_frontend_action(tu_vargs);
+            VAST_ASSERT(action);
+
+            auto kind = static_cast< const vast_stream_action & >(*action).action;
+            auto output = get_output_path(cmd, get_output_stream_suffix(kind, tu_vargs));
+
+            // Working directory of the physical file system is not shared with
+            // other threads, unlike the one of the real file system.
+            llvm::IntrusiveRefCntPtr< llvm::vfs::FileSystem > fs(
+                llvm::vfs::createPhysicalFileSystem().release()
+            );
+
+            if (fs->setCurrentWorkingDirectory(cmd.Directory)) {
+                report(cmd, "cannot change working directory to " + cmd.Directory);
+                return false;
+            }
+
+            clang::FileSystemOptions fs_opts;
+            fs_opts.WorkingDir = cmd.Directory;
+            llvm::IntrusiveRefCntPtr< clang::FileManager > files(
+                new clang::FileManager(fs_opts, fs)
+            );
+
+            batch_tool_action tool_action(std::move(action), output);
+            clang::tooling::ToolInvocation invocation(
+                adjuster(cmd.CommandLine, cmd.Filename), &tool_action, files.get()
+            );
+
+            if (!invocation.run()) {
+                report(cmd, "compilation failed");
+                return false;
+            }
+
+            return true;
+        }
+
+        void report(const compile_command &cmd, const llvm::Twine &msg) const {
+            std::scoped_lock lock(errs_mutex);
+            llvm::errs() << "error: " << cmd.Filename << ": " << msg << "\n";
+        }
+
+        vast_args tu_vargs;
+
+        clang::tooling::ArgumentsAdjuster adjuster = make_adjuster();
+
+        mutable std::mutex errs_mutex;
+    };
+
+    int batch(const vast_args &vargs, string_ref database) {
+        std::string err;
+        auto db = clang::tooling::JSONCompilationDatabase::loadFromFile(
+            database, err, clang::tooling::JSONCommandLineSyntax::AutoDetect
+        );
+
+        if (!db) {
+            llvm::errs() << "error: " << err << "\n";
+            return 1;
+        }
+
+        // Initialize targets once for all translation units.
+        llvm::InitializeAllTargets();
+        llvm::InitializeAllTargetMCs();
+        llvm::InitializeAllAsmPrinters();
+        llvm::InitializeAllAsmParsers();
+
+        // Options are shared by all translation units, hence they are
+        // validated once, before any unit is in flight. An unknown target
+        // dialect is fatal here rather than in the middle of the batch.
+        if (!create_frontend_action(vargs)) {
+            llvm::errs() << "error: batch mode requires one of -vast-emit-* options\n";
+            return 1;
+        }
+
+        if (auto target = vargs.get_option(opt::emit_mlir)) {
+            (void) parse_target_dialect(target.value());
+        }
+
+        batch_compiler compiler(vargs);
+
+        std::atomic< unsigned > failures = 0;
+
+        llvm::ThreadPool pool(llvm::hardware_concurrency(get_batch_threads(vargs)));
+        for (const auto &cmd : db->getAllCompileCommands()) {
+            pool.async([&compiler, &failures, cmd] {
+                if (!compiler.compile(cmd)) {
+                    ++failures;
+                }
+            });
+        }
+
+        pool.wait();
+
+        return failures ? 1 : 0;
+    }
+
+} // namespace vast::cc
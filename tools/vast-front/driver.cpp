@@ -24,6 +24,11 @@ namespace vast::cc {
     extern int cc1(const vast_args & vargs, argv_t argv, arg_t tool, void *main_addr);
 } // namespace vast::cc
 
+// batch compilation of a compilation database. Lives inside batch.cpp
+namespace vast::cc {
+    extern int batch(const vast_args &vargs, string_ref database);
+} // namespace vast::cc
+
 VAST_RELAX_WARNINGS
 std::string get_executable_path(vast::cc::arg_t tool, bool canonical_prefixes) {
     if (!canonical_prefixes) {
@@ -138,6 +143,16 @@ int main(int argc, char **argv) try {
 
     // FIXME: deal with CL mode
 
+    // Check if vast-front is in the batch mode
+    if (auto [vargs, _] = vast::cc::filter_args(cmd_args); vargs.has_option(vast::cc::opt::batch)) {
+        if (auto database = vargs.get_option(vast::cc::opt::batch)) {
+            return vast::cc::batch(vargs, database.value());
+        }
+
+        llvm::errs() << "error: -vast-batch requires a compilation database\n";
+        return 1;
+    }
+
     // Check if vast-front is in the frontend mode
     auto first_arg = llvm::find_if(llvm::drop_begin(cmd_args), [] (auto a) { return a != nullptr; });
     if (first_arg != cmd_args.end()) {
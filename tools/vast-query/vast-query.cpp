@@ -5,7 +5,6 @@
 VAST_RELAX_WARNINGS
 #include "mlir/IR/Dialect.h"
 #include "mlir/IR/MLIRContext.h"
-#include "mlir/InitAllDialects.h"
 #include "mlir/InitAllPasses.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Pass/PassManager.h"
@@ -24,6 +23,7 @@ VAST_UNRELAX_WARNINGS
 #include "vast/Dialect/HighLevel/HighLevelOps.hpp"
 #include "vast/Dialect/HighLevel/HighLevelTypes.hpp"
 #include "vast/Dialect/HighLevel/Passes.hpp"
+#include "vast/Util/Bytecode.hpp"
 #include "vast/Util/Common.hpp"
 #include "vast/Util/Symbols.hpp"
 
@@ -89,6 +89,14 @@ namespace vast::query
 
     bool constrained_scope() { return !cl::options->scope_name.empty(); }
 
+    // Functions and globals are visible without function bodies, hence they
+    // can be listed without materializing bodies of a lazily loaded module.
+    bool needs_function_bodies() {
+        using kind = cl::show_symbol_type;
+        auto show_kind = cl::options->show_symbols.getValue();
+        return !(show_kind == kind::function || show_kind == kind::global);
+    }
+
     template< typename... Ts >
     auto is_one_of() {
         return [](mlir::Operation *op) { return (mlir::isa< Ts >(op) || ...); };
@@ -167,17 +175,16 @@ namespace vast
     }
 
     logical_result do_query(mcontext_t &ctx, memory_buffer buffer) {
-        llvm::SourceMgr source_mgr;
-        source_mgr.AddNewSourceBuffer(std::move(buffer), llvm::SMLoc());
+        module_reader reader(&ctx);
 
-        mlir::SourceMgrDiagnosticHandler manager_handler(source_mgr, &ctx);
+        mlir::SourceMgrDiagnosticHandler manager_handler(reader.source_manager(), &ctx);
 
         // Disable multi-threading when parsing the input file. This removes the
         // unnecessary/costly context synchronization when parsing.
         bool wasThreadingEnabled = ctx.isMultithreadingEnabled();
         ctx.disableMultithreading();
 
-        owning_module_ref mod(mlir::parseSourceFile< vast_module >(source_mgr, &ctx));
+        owning_module_ref mod = reader.read(std::move(buffer));
         ctx.enableMultithreading(wasThreadingEnabled);
         if (!mod) {
             llvm::errs() << "error: cannot parse module\n";
@@ -198,10 +205,24 @@ namespace vast
 
         mlir::Operation *scope = mod.get();
         if (query::constrained_scope()) {
-            return get_scope_operation(scope, cl::options->scope_name, process_scope);
-        } else {
-            return process_scope(scope);
+            // Load only the body of the queried scope.
+            return get_scope_operation(scope, cl::options->scope_name, [&] (auto op) {
+                if (op && mlir::failed(reader.materialize(op))) {
+                    return mlir::failure();
+                }
+
+                return process_scope(op);
+            });
         }
+
+        if (!query::show_symbols() || query::needs_function_bodies()) {
+            if (mlir::failed(reader.materialize_all())) {
+                llvm::errs() << "error: cannot load function bodies\n";
+                return mlir::failure();
+            }
+        }
+
+        return process_scope(scope);
     }
 
     logical_result run(mcontext_t &ctx) {
@@ -221,10 +242,10 @@ int main(int argc, char **argv) {
 
     mlir::DialectRegistry registry;
     vast::registerAllDialects(registry);
-    mlir::registerAllDialects(registry);
+    vast::registerDependentDialects(registry);
 
+    // dialects are loaded by the parser as they are encountered
     vast::mcontext_t ctx(registry);
-    ctx.loadAllAvailableDialects();
 
     std::exit(failed(vast::run(ctx)));
 }
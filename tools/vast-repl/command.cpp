@@ -4,6 +4,7 @@
 
 #include "vast/Conversion/Passes.hpp"
 #include "vast/Tower/Tower.hpp"
+#include "vast/Util/Bytecode.hpp"
 #include "vast/repl/common.hpp"
 #include <optional>
 
@@ -29,11 +30,25 @@ namespace vast::repl::cmd {
         return file_buffer;
     }
 
+    // textual or bytecode MLIR module, anything else is considered a C source
+    bool is_mlir_source(const std::filesystem::path &path) {
+        auto ext = path.extension();
+        return ext == ".mlir" || ext == ".mlirbc";
+    }
+
+    owning_module_ref load_module(state_t &state) {
+        auto buff = get_source_buffer(state);
+        module_reader reader(&state.ctx, /* lazy */ false);
+        return reader.read(std::move(buff.get()));
+    }
+
     void check_and_emit_module(state_t &state) {
         if (!state.tower) {
             check_source(state);
-            auto mod    = codegen::emit_module(state.source.value(), &state.ctx);
-            auto [t, _] = tw::default_tower::get(state.ctx, std::move(mod));
+            auto mod    = is_mlir_source(state.source.value())
+                ? load_module(state)
+                : codegen::emit_module(state.source.value(), &state.ctx);
+            auto [t, _] = tw::snapshot_tower::get(state.ctx, std::move(mod));
             state.tower = std::move(t);
         }
     }
@@ -76,15 +91,48 @@ namespace vast::repl::cmd {
 
     void show_module(state_t &state) {
         check_and_emit_module(state);
-        llvm::outs() << state.tower->top().mod << "\n";
+        auto mod = state.tower->materialize(state.tower->top());
+        llvm::outs() << mod.get() << "\n";
     }
 
     void show_symbols(state_t &state) {
         check_and_emit_module(state);
 
-        util::symbols(state.tower->top().mod, [&] (auto symbol) {
-            llvm::outs() << util::show_symbol_value(symbol) << "\n";
-        });
+        for (auto op : state.tower->ops(state.tower->top())) {
+            util::symbols(op, [&] (auto symbol) {
+                llvm::outs() << util::show_symbol_value(symbol) << "\n";
+            });
+        }
+    }
+
+    void show_snapshots(state_t &state) {
+        check_and_emit_module(state);
+
+        const auto &tower = *state.tower;
+        for (std::size_t id = 0; id < tower.size(); ++id) {
+            tw::snapshot_tower::handle_t th{ id };
+            llvm::outs() << "snapshot " << id
+                         << " (parent " << tower.parent(th).id << "): "
+                         << tower.ops(th).size() << " ops, "
+                         << tower.owned_ops(th) << " owned\n";
+        }
+    }
+
+    void show_provenance(state_t &state) {
+        check_and_emit_module(state);
+
+        const auto &tower = *state.tower;
+        auto th = tower.top();
+        for (auto op : tower.ops(th)) {
+            op->walk< mlir::WalkOrder::PreOrder >([&] (operation nested) {
+                llvm::outs() << nested->getName() << " <- ";
+                if (auto prev = tower.prev(th, nested)) {
+                    llvm::outs() << prev->getName() << "\n";
+                } else {
+                    llvm::outs() << "none\n";
+                }
+            });
+        }
     }
 
     void show::run(state_t &state) const {
@@ -94,6 +142,8 @@ namespace vast::repl::cmd {
             case show_kind::ast:     return show_ast(state);
             case show_kind::module:  return show_module(state);
             case show_kind::symbols: return show_symbols(state);
+            case show_kind::snapshots:  return show_snapshots(state);
+            case show_kind::provenance: return show_provenance(state);
         }
     };
 
@@ -104,20 +154,38 @@ namespace vast::repl::cmd {
         using ::vast::meta::add_identifier;
 
         auto name_param = get_param< symbol_param >(params);
-        util::symbols(state.tower->top().mod, [&] (auto symbol) {
-            if (util::symbol_name(symbol) == name_param.value) {
-                auto id = get_param< identifier_param >(params);
-                add_identifier(symbol, id.value);
-                llvm::outs() << symbol << "\n";
+        auto id = get_param< identifier_param >(params);
+
+        auto matches = [&] (auto symbol) {
+            return util::symbol_name(symbol) == name_param.value;
+        };
+
+        // Top-level operations might be shared with previous snapshots, which
+        // must not see the identifier, hence they are copied before update.
+        auto th = state.tower->top();
+        for (auto op : llvm::to_vector(state.tower->ops(th))) {
+            bool found = false;
+            util::symbols(op, [&] (auto symbol) { found = found || matches(symbol); });
+            if (!found) {
+                continue;
             }
-        });
+
+            util::symbols(state.tower->own(th, op), [&] (auto symbol) {
+                if (matches(symbol)) {
+                    add_identifier(symbol, id.value);
+                    llvm::outs() << symbol << "\n";
+                }
+            });
+        }
     }
 
     void meta::get(state_t &state) const {
         using ::vast::meta::get_with_identifier;
         auto id = get_param< identifier_param >(params);
-        for (auto op : get_with_identifier(state.tower->top().mod, id.value)) {
-            llvm::outs() << *op << "\n";
+        for (auto scope : state.tower->ops(state.tower->top())) {
+            for (auto op : get_with_identifier(scope, id.value)) {
+                llvm::outs() << *op << "\n";
+            }
         }
     }
 
@@ -141,9 +209,14 @@ namespace vast::repl::cmd {
         llvm::SmallVector< llvm::StringRef, 2 > passes;
         llvm::StringRef(pipeline).split(passes, ',');
 
-        mlir::PassManager pm(&state.ctx);
         auto th = state.tower->top();
         for (auto pass : passes) {
+            // Every pass makes its own stage. HL passes are anchored on
+            // functions, the module manager nests them implicitly.
+            mlir::PassManager pm(
+                &state.ctx, vast_module::getOperationName(),
+                mlir::OpPassManager::Nesting::Implicit
+            );
             if (mlir::failed(mlir::parsePassPipeline(pass, pm))) {
                 VAST_FATAL("failed to parse pass pipeline");
             }
@@ -5,7 +5,6 @@
 VAST_RELAX_WARNINGS
 #include "mlir/IR/Dialect.h"
 #include "mlir/IR/MLIRContext.h"
-#include "mlir/InitAllDialects.h"
 #include "mlir/InitAllPasses.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Pass/PassManager.h"
@@ -84,10 +83,11 @@ int main(int argc, char **argv) try {
     mlir::registerAllPasses();
     // Register VAST passes here
     vast::registerConversionPasses();
+    vast::hl::registerHighLevelPasses();
 
     mlir::DialectRegistry registry;
     vast::registerAllDialects(registry);
-    mlir::registerAllDialects(registry);
+    vast::registerDependentDialects(registry);
 
     // register conversions
     mlir::registerAllToLLVMIRTranslations(registry);
@@ -95,7 +95,6 @@ int main(int argc, char **argv) try {
     args_t args = load_args(argc, argv);
 
     vast::mcontext_t ctx(registry);
-    ctx.loadAllAvailableDialects();
 
     auto prompt = vast::repl::prompt(ctx);
 